@@ -3,9 +3,110 @@
 #define CULL_BACK 1  // Culling Option: Back Face Polygon Culling
 #define CULL_FRONT 2 // Culling Option: Front Face Polygon Culling
 
+#define FOV_3D 240.0 // Projection: Field Of View Scale (Screen Pixels Per Unit At Z = 1)
+#define SCREEN_X_3D 160.0 // Projection: Screen Centre X
+#define SCREEN_Y_3D 120.0 // Projection: Screen Centre Y
+#define NEAR_3D 1.0 // Projection: Near Plane Eye Z
+#define DEPTH_3D 32767.0 // Z-Buffer: RDP Depth At Infinity (Depth = DEPTH_3D * (1 - NEAR_3D / Z), 0 At The Near Plane)
+
+#ifndef CLIP_GUARD_3D
+#define CLIP_GUARD_3D 1 // 1 = Also Clip Against The Screen Sides Pushed Out By GUARD_BAND_3D (Keeps Near Clipped Vertices In RDP Range)
+#endif
+#define GUARD_BAND_3D 512.0 // Clip Guard Band: Pixels Beyond Each Screen Edge Left To The Scissor
+
+#define CLIP_NEAR 0x01   // Clip Code: Vertex In Front Of The Near Plane (Screen X,Y Invalid)
+#define CLIP_LEFT 0x02   // Clip Code: Vertex Left Of The Guard Band
+#define CLIP_RIGHT 0x04  // Clip Code: Vertex Right Of The Guard Band
+#define CLIP_TOP 0x08    // Clip Code: Vertex Above The Guard Band
+#define CLIP_BOTTOM 0x10 // Clip Code: Vertex Below The Guard Band
+#define CLIP_SCREEN_LEFT 0x20    // Clip Code: Vertex Left Of The Screen (Scissor)
+#define CLIP_SCREEN_RIGHT 0x40   // Clip Code: Vertex Right Of The Screen
+#define CLIP_SCREEN_TOP 0x80     // Clip Code: Vertex Above The Screen
+#define CLIP_SCREEN_BOTTOM 0x100 // Clip Code: Vertex Below The Screen
+#define CLIP_PLANES 0x1F  // Clip Codes That Need The Clipper (Near & Guard Band)
+#define CLIP_SCREEN 0x1E0 // Clip Codes Of The Screen Edges (Trivial Reject Only)
+#define CLIP_MAX_VERTS 8 // Clipped Polygon Size (Triangle + One Vertex Per Clip Plane)
+
+#define ROTATE_X 0x01 // Instance Rotation Axis: X
+#define ROTATE_Y 0x02 // Instance Rotation Axis: Y
+#define ROTATE_Z 0x04 // Instance Rotation Axis: Z
+
+#define TRI_ACCEPT 0 // Triangle Test: Draw Unclipped
+#define TRI_REJECT 1 // Triangle Test: Wholly Off Screen Or Behind The Near Plane
+#define TRI_CLIP 2   // Triangle Test: Send Through The Clipper
+
+#define BOUND_OUTSIDE 0   // Bound Test: Object Wholly Outside The View Frustum
+#define BOUND_INTERSECT 1 // Bound Test: Object Crosses A Frustum Plane
+#define BOUND_INSIDE 2    // Bound Test: Object Wholly Inside The View Frustum
+
+#ifndef FIXED_3D
+#define FIXED_3D 0 // 1 = Transform Meshes In Fixed Point (Int16 Vertices, S15.16 Matrix, One Reciprocal Per Vertex)
+#endif
+
 // 3D Functions
 typedef struct { float x, y, z; } XYZResult;
 typedef struct { float x, y; } XYResult;
+typedef struct { float x, y, z, inv_w; } XYZWResult; // Screen X,Y, Eye Z (W) & 1/W (For Perspective Correct Setup)
+typedef struct { int32_t x, y, z; } XYZFixed; // S15.16
+typedef struct { int32_t x, y, scale; } XYFixed; // Integer Screen Pixels & FOV / Z (Q14)
+typedef struct { float x, y, w, s, t, r, g, b, a; } ClipVertex3D; // Homogeneous Screen X * W, Screen Y * W, W (Eye Z), Texel S,T & Color R,G,B,A
+typedef struct { float x, y, z, inv_w, s, t, r, g, b, a; } ClipPoint3D; // Clipped Polygon Vertex: Screen X,Y, Eye Z (W), 1/W, Texel S,T & Color R,G,B,A
+
+// Bounding Volume: Model Space Sphere & Axis Aligned Box Enclosing Every Vertex
+typedef struct {
+  float centre[3]; // Sphere Centre X, Y, Z
+  float radius; // Sphere Radius
+  float min[3]; // Box Minimum X, Y, Z
+  float max[3]; // Box Maximum X, Y, Z
+} Bound3D;
+
+// Indexed Mesh: Unique Vertices, 16-Bit Triangle Indices & Per-Face Attributes
+typedef struct {
+  float *vert; // Vertex Array: X, Y, Z Per Vertex
+  int16_t *vert16; // Integer Vertex Array (FIXED_3D): X, Y, Z Per Vertex In Model Units
+  uint16_t *index; // Index Array: 3 Vertex Indices Per Triangle (Clockwise Winding)
+  uint8_t *col; // Face Color Array: R, G, B, A Per Triangle
+  uint8_t *vert_col; // Vertex Color Array: R, G, B, A Per Vertex (Gouraud Shading, NULL = Face Colors Only)
+  float *uv; // Texture Coordinate Array: S, T Per Triangle Corner In Texels (NULL = Untextured)
+  float *normal; // Face Plane Array: NX, NY, NZ, D Per Triangle (Outward Normal, D = N . Vertex 1; NULL = Cull In Screen Space)
+  Bound3D *bound; // Bounding Volume (NULL = Never Frustum Culled)
+  uint16_t vert_count; // Number Of Vertices (Up To MESH_MAX_VERTS)
+  uint16_t tri_count; // Number Of Triangles
+} Mesh3D;
+
+// Mesh Instance: Placement & Colors Of One Copy Of A Shared Mesh
+typedef struct {
+  float pos[3]; // Translation X, Y, Z
+  uint16_t rot[3]; // Rotation X, Y, Z (0..1023)
+  uint8_t axes; // Rotations Applied: ROTATE_X | ROTATE_Y | ROTATE_Z (0 = None, Same Orders As rotate_*)
+  uint8_t *col; // Face Color Array (NULL = The Mesh Colors)
+} Instance3D;
+
+#define MESH_MAX_VERTS 256 // Mesh Scratch Buffer Size (Largest Vertex Count Of A Single Mesh)
+#define MESH_MAX_FACES 512 // Mesh Face Flag Buffer Size (Largest Triangle Count Of A Single Mesh)
+
+// Mesh Scratch Buffers: Each Unique Vertex Is Transformed Once Per Draw
+static float MeshZ[MESH_MAX_VERTS]; // Eye Z Per Vertex (Near Plane Clip Codes)
+static XYResult MeshXY[MESH_MAX_VERTS];
+static float MeshInvW[MESH_MAX_VERTS]; // 1/W Per Vertex (0 When Behind The Eye)
+#if FIXED_3D
+static XYFixed MeshXYFixed[MESH_MAX_VERTS];
+#endif
+static uint16_t MeshClip[MESH_MAX_VERTS]; // Clip Codes Per Vertex
+static uint8_t MeshVertUsed[MESH_MAX_VERTS]; // Set By cull_mesh: Vertex Belongs To A Visible Face
+static uint8_t MeshFaceVisible[MESH_MAX_FACES]; // Set By cull_mesh: Face Survived Object Space Culling
+
+// 3D Frame Statistics (Cleared By stats_3d_reset, Once Per Frame)
+typedef struct {
+  uint32_t faces_culled; // Faces Rejected In Object Space (Before Any Transform)
+  uint32_t verts_transformed; // Mesh Vertices Transformed & Projected
+  uint32_t objects_culled; // Meshes Rejected Whole By Their Bounding Volume
+  uint32_t tris_clipped; // Triangles Sent Through The Clipper
+  uint32_t tris_rejected; // Triangles Trivially Rejected Off Screen (Never Encoded)
+  uint32_t tris_guard_accepted; // Triangles Crossing The Screen Edge Drawn Unclipped (Inside The Guard Band)
+} Stats3D;
+
+static Stats3D stats_3d;
 
 // Matrix 3D Data
 static float Matrix3D[12] = {
@@ -15,6 +116,11 @@ static float Matrix3D[12] = {
   0.0, 0.0, 1.0, 0.0, // Z
 };
 
+// Matrix Stack: Saved Parent Matrices Of Matrix3D (Hierarchical Transforms)
+#define MATRIX_STACK_DEPTH 8 // Deepest Push Nesting
+static float MatrixStack[MATRIX_STACK_DEPTH][12];
+static uint32_t MatrixStackTop = 0; // Number Of Saved Matrices
+
 // Reset Matrix To Identity
 void matrix_identity( float matrix[] )
 {
@@ -58,6 +164,41 @@ XYResult calc_2d( float x, float y, float z )
   return res;
 }
 
+// Calculate Z-Buffer Depth: 1/W (Linear In Screen Space, So The RDP Interpolates It Exactly)
+float depth_3d( float inv_w )
+{
+  float depth = DEPTH_3D - (DEPTH_3D * NEAR_3D) * inv_w;
+  return (depth > 0.0) ? depth : 0.0; // Clipped Vertices Can Land A Rounding Error In Front Of The Near Plane
+}
+
+// Fold Projection Into Matrix: Matrix, Projection Matrix (Rows Give FOV*X + Centre*Z, Centre*Z - FOV*Y, W = Z)
+void matrix_project( float matrix[], float proj[] )
+{
+  for(int i = 0; i < 4; i++) {
+    proj[i] = (FOV_3D * matrix[i]) + (SCREEN_X_3D * matrix[8 + i]); // X Row
+    proj[4 + i] = (SCREEN_Y_3D * matrix[8 + i]) - (FOV_3D * matrix[4 + i]); // Y Row
+    proj[8 + i] = matrix[8 + i]; // W Row
+  }
+}
+
+// Calculate Projection: Projection Matrix, X,Y,Z (One Reciprocal Per Vertex)
+XYZWResult calc_project( float proj[], float x, float y, float z )
+{
+  XYZWResult res;
+  res.z = (proj[8] * x) + (proj[9] * y) + (proj[10] * z) + proj[11]; // W = Eye Z
+  if (res.z > 0.0) { // Do Not Divide By Zero
+    res.inv_w = 1.0 / res.z;
+    res.x = (float)(int)(((proj[0] * x) + (proj[1] * y) + (proj[2] * z) + proj[3]) * res.inv_w); // round(X = (X * FOV / Z) + (Screen X / 2))
+    res.y = (float)(int)(((proj[4] * x) + (proj[5] * y) + (proj[6] * z) + proj[7]) * res.inv_w); // round(Y = (Screen Y / 2) - (Y * FOV / Z))
+  }
+  else {
+    res.x = 0.0;
+    res.y = 0.0;
+    res.inv_w = 0.0;
+  }
+  return res;
+}
+
 // Test Polygon Winding Direction (IF Triangle Winding > 0.0: Clockwise ELSE: Anti-Clockwise)
 int poly_winding( float x1, float y1, float x2, float y2, float x3, float y3 )
 {
@@ -66,6 +207,352 @@ int poly_winding( float x1, float y1, float x2, float y2, float x3, float y3 )
   return Hdx * Mdy - Hdy * Mdx;
 }
 
+// Calculate Clip Code: Eye Z, 2D Point (Returns CLIP_* Bits, 0 = On Screen)
+uint16_t clip_code( float z, XYResult xy )
+{
+  if (z < NEAR_3D) return CLIP_NEAR; // Screen Position Is Meaningless Behind The Near Plane
+  uint16_t code = 0;
+  if (xy.x < 0.0) code |= CLIP_SCREEN_LEFT;
+  if (xy.x >= (2.0 * SCREEN_X_3D)) code |= CLIP_SCREEN_RIGHT;
+  if (xy.y < 0.0) code |= CLIP_SCREEN_TOP;
+  if (xy.y >= (2.0 * SCREEN_Y_3D)) code |= CLIP_SCREEN_BOTTOM;
+#if CLIP_GUARD_3D
+  if (xy.x < -GUARD_BAND_3D) code |= CLIP_LEFT;
+  if (xy.x > ((2.0 * SCREEN_X_3D) + GUARD_BAND_3D)) code |= CLIP_RIGHT;
+  if (xy.y < -GUARD_BAND_3D) code |= CLIP_TOP;
+  if (xy.y > ((2.0 * SCREEN_Y_3D) + GUARD_BAND_3D)) code |= CLIP_BOTTOM;
+#endif
+  return code;
+}
+
+// Classify Triangle: Clip Codes 1,2,3 (Returns TRI_ACCEPT, TRI_REJECT Or TRI_CLIP)
+uint8_t clip_test( uint16_t code1, uint16_t code2, uint16_t code3 )
+{
+  if (code1 & code2 & code3) { // Trivial Reject: Every Vertex Outside The Same Screen Edge (Or Behind The Near Plane)
+    stats_3d.tris_rejected++;
+    return TRI_REJECT;
+  }
+
+  uint16_t code = code1 | code2 | code3;
+  if (code & CLIP_PLANES) return TRI_CLIP;
+  if (code & CLIP_SCREEN) stats_3d.tris_guard_accepted++; // Trivial Accept: Inside The Guard Band, The Scissor Trims The Rest
+  return TRI_ACCEPT;
+}
+
+// Clip Polygon Against One Plane: Polygon, Vertex Count, Plane (A*X + B*Y + C*W + D >= 0 Is Kept), Output Polygon
+// Returns The Output Vertex Count (Sutherland-Hodgman)
+uint8_t clip_plane( ClipVertex3D in[], uint8_t count, const float plane[], ClipVertex3D out[] )
+{
+  uint8_t n = 0;
+  ClipVertex3D *a = &in[count - 1];
+  float da = (plane[0] * a->x) + (plane[1] * a->y) + (plane[2] * a->w) + plane[3];
+
+  for(uint8_t k = 0; k < count; k++) {
+    ClipVertex3D *b = &in[k];
+    float db = (plane[0] * b->x) + (plane[1] * b->y) + (plane[2] * b->w) + plane[3];
+
+    if ((da >= 0.0) != (db >= 0.0)) { // Edge Crosses The Plane: Emit The Intersection
+      // Always Interpolate From The Inside Vertex, So An Edge Shared By Two Triangles Clips To The Same Point
+      ClipVertex3D *p = (da >= 0.0) ? a : b, *q = (da >= 0.0) ? b : a;
+      float t = (da >= 0.0) ? (da / (da - db)) : (db / (db - da));
+      out[n].x = p->x + (t * (q->x - p->x));
+      out[n].y = p->y + (t * (q->y - p->y));
+      out[n].w = p->w + (t * (q->w - p->w));
+      out[n].s = p->s + (t * (q->s - p->s)); // Texel S,T Are Linear In Homogeneous Space Like X, Y & W
+      out[n].t = p->t + (t * (q->t - p->t));
+      out[n].r = p->r + (t * (q->r - p->r)); // Colors Too (Gouraud Shading Is Linear Across The Triangle)
+      out[n].g = p->g + (t * (q->g - p->g));
+      out[n].b = p->b + (t * (q->b - p->b));
+      out[n].a = p->a + (t * (q->a - p->a));
+      n++;
+    }
+    if (db >= 0.0) out[n++] = *b; // Keep Inside Vertex
+
+    a = b;
+    da = db;
+  }
+  return n;
+}
+
+// Clip Triangle: Eye Space Points 1,2,3, Texel S,T Per Point (NULL = Untextured), Color R,G,B,A Per Point (NULL = Unshaded), Culling,
+// Output Polygon (Screen X,Y, Eye Z, 1/W, S,T & R,G,B,A Per Vertex)
+// Returns The Polygon Vertex Count To Draw As A Fan (0 = Clipped Away Or Culled)
+uint8_t clip_triangle( XYZResult xyz1, XYZResult xyz2, XYZResult xyz3, const float st[], const uint8_t rgba[], uint8_t cull, ClipPoint3D poly[] )
+{
+  // Eye Space Planes In Homogeneous Screen Space: Near, Then The Guard Band Sides
+  static const float plane[5][4] = {
+    { 0.0, 0.0, 1.0, -NEAR_3D }, // Near: W >= NEAR_3D
+    {  1.0, 0.0, GUARD_BAND_3D, 0.0 }, // Left: Screen X >= -Guard
+    { -1.0, 0.0, (2.0 * SCREEN_X_3D) + GUARD_BAND_3D, 0.0 }, // Right: Screen X <= Screen Width + Guard
+    { 0.0,  1.0, GUARD_BAND_3D, 0.0 }, // Top: Screen Y >= -Guard
+    { 0.0, -1.0, (2.0 * SCREEN_Y_3D) + GUARD_BAND_3D, 0.0 } // Bottom: Screen Y <= Screen Height + Guard
+  };
+  ClipVertex3D buf[2][CLIP_MAX_VERTS];
+  uint8_t count = 3, src = 0;
+
+  // Projection Without The Divide (Matches calc_2d): X * FOV + Centre X * Z, Centre Y * Z - Y * FOV, W = Z
+  buf[0][0].x = (FOV_3D * xyz1.x) + (SCREEN_X_3D * xyz1.z); buf[0][0].y = (SCREEN_Y_3D * xyz1.z) - (FOV_3D * xyz1.y); buf[0][0].w = xyz1.z;
+  buf[0][1].x = (FOV_3D * xyz2.x) + (SCREEN_X_3D * xyz2.z); buf[0][1].y = (SCREEN_Y_3D * xyz2.z) - (FOV_3D * xyz2.y); buf[0][1].w = xyz2.z;
+  buf[0][2].x = (FOV_3D * xyz3.x) + (SCREEN_X_3D * xyz3.z); buf[0][2].y = (SCREEN_Y_3D * xyz3.z) - (FOV_3D * xyz3.y); buf[0][2].w = xyz3.z;
+  for(int k = 0; k < 3; k++) {
+    buf[0][k].s = (st != NULL) ? st[k * 2] : 0.0;
+    buf[0][k].t = (st != NULL) ? st[(k * 2) + 1] : 0.0;
+    buf[0][k].r = (rgba != NULL) ? rgba[k * 4] : 0.0;
+    buf[0][k].g = (rgba != NULL) ? rgba[(k * 4) + 1] : 0.0;
+    buf[0][k].b = (rgba != NULL) ? rgba[(k * 4) + 2] : 0.0;
+    buf[0][k].a = (rgba != NULL) ? rgba[(k * 4) + 3] : 0.0;
+  }
+  stats_3d.tris_clipped++;
+
+  for(int p = 0; p < (CLIP_GUARD_3D ? 5 : 1); p++) {
+    count = clip_plane(buf[src], count, plane[p], buf[src ^ 1]);
+    src ^= 1;
+    if (count < 3) return 0; // Wholly Outside
+  }
+
+  // Project The Polygon (One Reciprocal Per Vertex, Truncated Like calc_2d)
+  int winding = 0;
+  uint16_t outside = CLIP_SCREEN;
+  for(uint8_t k = 0; k < count; k++) {
+    poly[k].z = buf[src][k].w;
+    poly[k].inv_w = 1.0 / buf[src][k].w;
+    poly[k].x = (float)(int)(buf[src][k].x * poly[k].inv_w);
+    poly[k].y = (float)(int)(buf[src][k].y * poly[k].inv_w);
+    poly[k].s = buf[src][k].s;
+    poly[k].t = buf[src][k].t;
+    poly[k].r = buf[src][k].r;
+    poly[k].g = buf[src][k].g;
+    poly[k].b = buf[src][k].b;
+    poly[k].a = buf[src][k].a;
+    XYResult xy = { poly[k].x, poly[k].y };
+    outside &= clip_code(poly[k].z, xy);
+    if (k >= 2) winding += poly_winding(poly[0].x,poly[0].y, poly[k - 1].x,poly[k - 1].y, poly[k].x,poly[k].y);
+  }
+
+  if (outside) { // The Clipped Polygon Still Lies Wholly Off Screen
+    stats_3d.tris_rejected++;
+    return 0;
+  }
+
+  // Cull The Whole Clipped Polygon (Its Fan Triangles Share One Winding)
+  if((cull == CULL_NONE) || ((winding <= 0) && (cull == CULL_BACK)) || ((winding > 0) && (cull == CULL_FRONT))) return count;
+  return 0;
+}
+
+// Convert Matrix To Fixed Point: Float Matrix, S15.16 Matrix
+void matrix_fixed( float matrix[], int32_t fixed[] )
+{
+  for(int i = 0; i < 12; i++) fixed[i] = (int32_t)(matrix[i] * 65536.0 + ((matrix[i] < 0.0) ? -0.5 : 0.5)); // Rounded
+}
+
+// Calculate 3D Fixed Point: S15.16 Matrix, X,Y,Z (Model Units), Returns S15.16
+XYZFixed calc_3d_fixed( int32_t matrix[], int16_t x, int16_t y, int16_t z )
+{
+  // 32x32 Multiplies Accumulate In 64 Bits (One MULT Each On The VR4300, No Library Calls)
+  XYZFixed res;
+  res.x = (int32_t)((int64_t)matrix[0] * x + (int64_t)matrix[1] * y + (int64_t)matrix[2] * z) + matrix[3];
+  res.y = (int32_t)((int64_t)matrix[4] * x + (int64_t)matrix[5] * y + (int64_t)matrix[6] * z) + matrix[7];
+  res.z = (int32_t)((int64_t)matrix[8] * x + (int64_t)matrix[9] * y + (int64_t)matrix[10] * z) + matrix[11];
+  return res;
+}
+
+// Calculate 2D Fixed Point: X,Y,Z (S15.16), Returns Integer Screen X,Y
+XYFixed calc_2d_fixed( int32_t x, int32_t y, int32_t z )
+{
+  XYFixed res;
+  if (z >= 256) { // Do Not Divide By Zero (Z Below 1/256 Is Treated As Behind The Eye)
+    int32_t scale = ((int32_t)FOV_3D << 22) / ((z + 128) >> 8); // One Reciprocal: FOV / Z In Q14 (Numerator & Rounded Z In Q8 Keep 32 Bits)
+    res.scale = scale;
+    res.x = (int32_t)(((int64_t)x * scale + ((int64_t)SCREEN_X_3D << 30)) >> 30); // X = (X * FOV / Z) + (Screen X / 2) (Q16 * Q14 = Q30)
+    res.y = (int32_t)((((int64_t)SCREEN_Y_3D << 30) - (int64_t)y * scale) >> 30); // Y = (Screen Y / 2) - (Y * FOV / Z)
+  }
+  else {
+    res.x = 0;
+    res.y = 0;
+    res.scale = 0;
+  }
+  return res;
+}
+
+// Clear 3D Frame Statistics
+void stats_3d_reset( void )
+{
+  stats_3d.faces_culled = 0;
+  stats_3d.verts_transformed = 0;
+  stats_3d.objects_culled = 0;
+  stats_3d.tris_clipped = 0;
+  stats_3d.tris_rejected = 0;
+  stats_3d.tris_guard_accepted = 0;
+}
+
+// Test Bound Against The View Frustum: Bound (Model Space, Placed By Matrix3D)
+// Returns BOUND_OUTSIDE, BOUND_INTERSECT Or BOUND_INSIDE
+uint8_t frustum_bound( Bound3D *bound )
+{
+  // Eye Space Frustum Planes Of calc_2d (Inside: A*X + B*Y + C*Z + D >= 0, Not Normalized)
+  static const float plane[5][4] = {
+    {  FOV_3D, 0.0, SCREEN_X_3D, 0.0 }, // Left: Screen X >= 0
+    { -FOV_3D, 0.0, SCREEN_X_3D, 0.0 }, // Right: Screen X <= Screen Width
+    { 0.0, -FOV_3D, SCREEN_Y_3D, 0.0 }, // Top: Screen Y >= 0
+    { 0.0,  FOV_3D, SCREEN_Y_3D, 0.0 }, // Bottom: Screen Y <= Screen Height
+    { 0.0, 0.0, 1.0, -NEAR_3D }         // Near: Z >= NEAR_3D
+  };
+  uint8_t result = BOUND_INSIDE;
+
+  // Sphere (Cheap): Squared Distances Avoid Normalizing The Planes, Radius Scaled By The Longest Matrix Column (Largest Axis Scale)
+  // That Is The Largest Stretch Only While The Columns Stay Orthogonal (Rigid, Or Axis Scales Applied Before Rotating), Else Go Straight To The Box
+  float col2[3], s2 = 0.0;
+  uint8_t orthogonal = 1;
+  for(int j = 0; j < 3; j++) {
+    col2[j] = (Matrix3D[j] * Matrix3D[j]) + (Matrix3D[4 + j] * Matrix3D[4 + j]) + (Matrix3D[8 + j] * Matrix3D[8 + j]);
+    if (col2[j] > s2) s2 = col2[j];
+  }
+  for(int j = 0; j < 3; j++) {
+    int k = (j + 1) % 3;
+    float dot = (Matrix3D[j] * Matrix3D[k]) + (Matrix3D[4 + j] * Matrix3D[4 + k]) + (Matrix3D[8 + j] * Matrix3D[8 + k]);
+    if ((dot * dot) > (1e-6 * col2[j] * col2[k])) orthogonal = 0; // Columns Further Than ~0.06 Degrees From Square
+  }
+  XYZResult c;
+  if (orthogonal) {
+    c = calc_3d(Matrix3D, bound->centre[0], bound->centre[1], bound->centre[2]);
+    float r2 = bound->radius * bound->radius * s2;
+    for(int p = 0; p < 5; p++) {
+      float d = (plane[p][0] * c.x) + (plane[p][1] * c.y) + (plane[p][2] * c.z) + plane[p][3];
+      float rr = r2 * ((plane[p][0] * plane[p][0]) + (plane[p][1] * plane[p][1]) + (plane[p][2] * plane[p][2]));
+      if ((d * d) < rr) result = BOUND_INTERSECT; // Sphere Crosses This Plane
+      else if (d < 0.0) return BOUND_OUTSIDE; // Sphere Wholly Outside This Plane
+    }
+    if (result == BOUND_INSIDE) return BOUND_INSIDE;
+  }
+
+  // Box (Tighter): Project The Transformed Box Half Extents Onto Each Plane Normal
+  float hx = 0.5 * (bound->max[0] - bound->min[0]);
+  float hy = 0.5 * (bound->max[1] - bound->min[1]);
+  float hz = 0.5 * (bound->max[2] - bound->min[2]);
+  c = calc_3d(Matrix3D, bound->min[0] + hx, bound->min[1] + hy, bound->min[2] + hz);
+  result = BOUND_INSIDE;
+  for(int p = 0; p < 5; p++) {
+    float d = (plane[p][0] * c.x) + (plane[p][1] * c.y) + (plane[p][2] * c.z) + plane[p][3];
+    float ex = (plane[p][0] * Matrix3D[0]) + (plane[p][1] * Matrix3D[4]) + (plane[p][2] * Matrix3D[8]);
+    float ey = (plane[p][0] * Matrix3D[1]) + (plane[p][1] * Matrix3D[5]) + (plane[p][2] * Matrix3D[9]);
+    float ez = (plane[p][0] * Matrix3D[2]) + (plane[p][1] * Matrix3D[6]) + (plane[p][2] * Matrix3D[10]);
+    float r = (hx * ((ex < 0.0) ? -ex : ex)) + (hy * ((ey < 0.0) ? -ey : ey)) + (hz * ((ez < 0.0) ? -ez : ez));
+    if ((d + r) < 0.0) return BOUND_OUTSIDE; // Every Box Corner Outside This Plane
+    if ((d - r) < 0.0) result = BOUND_INTERSECT;
+  }
+  return result;
+}
+
+// Calculate Eye In Model Space: Matrix (Inverse Of The Model-View Matrix Applied To The Eye At The Origin)
+XYZResult matrix_eye( float matrix[] )
+{
+  // Inverse 3x3 By Cofactors (One Divide), Then Eye = -Inverse * Translation
+  float c0 = (matrix[5] * matrix[10]) - (matrix[6] * matrix[9]);
+  float c1 = (matrix[6] * matrix[8]) - (matrix[4] * matrix[10]);
+  float c2 = (matrix[4] * matrix[9]) - (matrix[5] * matrix[8]);
+  float det = (matrix[0] * c0) + (matrix[1] * c1) + (matrix[2] * c2);
+  float inv = (det != 0.0) ? (1.0 / det) : 0.0;
+
+  float tx = matrix[3], ty = matrix[7], tz = matrix[11];
+  XYZResult res;
+  res.x = -inv * ((c0 * tx) + (((matrix[2] * matrix[9]) - (matrix[1] * matrix[10])) * ty) + (((matrix[1] * matrix[6]) - (matrix[2] * matrix[5])) * tz));
+  res.y = -inv * ((c1 * tx) + (((matrix[0] * matrix[10]) - (matrix[2] * matrix[8])) * ty) + (((matrix[2] * matrix[4]) - (matrix[0] * matrix[6])) * tz));
+  res.z = -inv * ((c2 * tx) + (((matrix[1] * matrix[8]) - (matrix[0] * matrix[9])) * ty) + (((matrix[0] * matrix[5]) - (matrix[1] * matrix[4])) * tz));
+  return res;
+}
+
+// Cull Mesh: Mesh, Culling (Rejects Meshes Outside The Frustum, Tests Face Normals Against The Eye In Model Space, Marks Visible Faces & Their Vertices)
+// Returns The Number Of Visible Faces (0 Also When The Mesh Does Not Fit The Scratch Buffers)
+uint32_t cull_mesh( Mesh3D *mesh, uint8_t cull )
+{
+  if ((mesh->vert_count > MESH_MAX_VERTS) || (mesh->tri_count > MESH_MAX_FACES)) return 0; // Mesh Does Not Fit The Scratch Buffers
+
+  // Reject The Whole Object Before Any Per-Vertex Work
+  if ((mesh->bound != NULL) && (frustum_bound(mesh->bound) == BOUND_OUTSIDE)) {
+    stats_3d.objects_culled++;
+    return 0;
+  }
+
+  // Without Normals (Or Culling) Every Face Is Kept & Culling Falls Back To The Screen Space Winding Test
+  if ((mesh->normal == NULL) || (cull == CULL_NONE)) {
+    for(uint32_t i = 0; i < mesh->vert_count; i++) MeshVertUsed[i] = 1;
+    for(uint32_t t = 0; t < mesh->tri_count; t++) MeshFaceVisible[t] = 1;
+    return mesh->tri_count;
+  }
+
+  XYZResult eye = matrix_eye(Matrix3D);
+  uint32_t visible = 0;
+  for(uint32_t i = 0; i < mesh->vert_count; i++) MeshVertUsed[i] = 0;
+
+  for(uint32_t t = 0, i = 0, n = 0; t < mesh->tri_count; t++, i += 3, n += 4) {
+    // Facing > 0: Eye Is On The Outward Side Of The Face Plane (Front Face)
+    float facing = (mesh->normal[n] * eye.x) + (mesh->normal[n + 1] * eye.y) + (mesh->normal[n + 2] * eye.z) - mesh->normal[n + 3];
+    MeshFaceVisible[t] = (cull == CULL_BACK) ? (facing >= 0.0) : (facing < 0.0);
+
+    if (MeshFaceVisible[t]) {
+      MeshVertUsed[mesh->index[i]] = 1;
+      MeshVertUsed[mesh->index[i + 1]] = 1;
+      MeshVertUsed[mesh->index[i + 2]] = 1;
+      visible++;
+    }
+  }
+
+  stats_3d.faces_culled += mesh->tri_count - visible;
+  return visible;
+}
+
+// Transform Mesh: Mesh (Calculates 2D Point, Eye Z & 1/W Of Every Vertex Marked By cull_mesh Into MeshXY, MeshZ, MeshInvW & MeshClip)
+void transform_mesh( Mesh3D *mesh )
+{
+#if FIXED_3D
+  int32_t matrix[12];
+  matrix_fixed(Matrix3D, matrix); // Once Per Mesh, Not Per Vertex
+
+  for(uint32_t i = 0, v = 0; i < mesh->vert_count; i++, v += 3) {
+    if (!MeshVertUsed[i]) continue; // Only Used By Culled Faces
+    stats_3d.verts_transformed++;
+
+    XYZFixed xyz = calc_3d_fixed(matrix, mesh->vert16[v], mesh->vert16[v + 1], mesh->vert16[v + 2]); // Calculate 3D Point
+    MeshXYFixed[i] = calc_2d_fixed(xyz.x, xyz.y, xyz.z); // Calculate 2D Point
+
+    // Float Copies For The Paths That Still Set Up Triangles In Float (Z-Buffer & Texture)
+    MeshXY[i].x = MeshXYFixed[i].x;
+    MeshXY[i].y = MeshXYFixed[i].y;
+    MeshZ[i] = xyz.z * (1.0 / 65536.0);
+    MeshInvW[i] = MeshXYFixed[i].scale * (1.0 / (FOV_3D * 16384.0)); // 1/W From The Reciprocal Already Taken
+    MeshClip[i] = clip_code(MeshZ[i], MeshXY[i]);
+  }
+#else
+  float proj[12];
+  matrix_project(Matrix3D, proj); // Once Per Mesh, Not Per Vertex
+
+  for(uint32_t i = 0, v = 0; i < mesh->vert_count; i++, v += 3) {
+    if (!MeshVertUsed[i]) continue; // Only Used By Culled Faces
+    stats_3d.verts_transformed++;
+
+    XYZWResult xyzw = calc_project(proj, mesh->vert[v], mesh->vert[v + 1], mesh->vert[v + 2]); // Calculate 2D Point, Eye Z & 1/W
+    MeshXY[i].x = xyzw.x;
+    MeshXY[i].y = xyzw.y;
+    MeshZ[i] = xyzw.z;
+    MeshInvW[i] = xyzw.inv_w;
+    MeshClip[i] = clip_code(MeshZ[i], MeshXY[i]);
+  }
+#endif
+}
+
+// Clip Mesh Face: Mesh, First Index Of The Face, Culling, Output Polygon (Recomputes Eye Space In Float: Rare Path)
+uint8_t clip_mesh_face( Mesh3D *mesh, uint32_t i, uint8_t cull, ClipPoint3D poly[] )
+{
+  float *v1 = &mesh->vert[mesh->index[i] * 3], *v2 = &mesh->vert[mesh->index[i + 1] * 3], *v3 = &mesh->vert[mesh->index[i + 2] * 3];
+
+  // Gather The Corner Colors (Vertex Colors Are Indexed, The Clipper Takes Them Per Corner; Without Them Every Corner Gets The Face Color)
+  uint8_t rgba[12];
+  for(int k = 0; k < 12; k++) rgba[k] = (mesh->vert_col != NULL) ? mesh->vert_col[(mesh->index[i + (k >> 2)] * 4) + (k & 3)] : mesh->col[((i / 3) * 4) + (k & 3)];
+
+  return clip_triangle(calc_3d(Matrix3D, v1[0], v1[1], v1[2]), calc_3d(Matrix3D, v2[0], v2[1], v2[2]), calc_3d(Matrix3D, v3[0], v3[1], v3[2]),
+    (mesh->uv != NULL) ? &mesh->uv[i * 2] : NULL, rgba, (mesh->normal != NULL) ? CULL_NONE : cull, poly); // Faces With Normals Were Already Culled In Object Space
+}
+
 // Fill Point Array: Vert Array, Color Array, Point Size, Base, Length
 void fill_point_array( float vert[], uint8_t col[], uint16_t size, uint32_t base, uint32_t length)
 {
@@ -78,7 +565,6 @@ void fill_point_array( float vert[], uint8_t col[], uint16_t size, uint32_t base
 
     rdp_set_blend_color(col[c], col[c + 1], col[c + 2], col[c + 3]); // Set Blend Color: R,G,B,A
     rdp_fill_rectangle( xy.x,xy.y, xy.x + size,xy.y + size ); // Fill Rectangle: XH,YH, XL,YL
-    rdp_sync_pipe(); // Stall Pipeline, Until Preceeding Primitives Completely Finish
   }
 }
 
@@ -88,14 +574,14 @@ void fill_zbuffer_point_array( float vert[], uint8_t col[], uint16_t size, uint3
   for(uint32_t v = base, c = (base / 3) << 2; v < (base + length); v += 3, c += 4) {
     // Calculate 3D Point
     XYZResult xyz = calc_3d(Matrix3D, vert[v], vert[v + 1], vert[v + 2]);
+    if (xyz.z < NEAR_3D) continue; // Behind The Near Plane: No Screen Position & No Depth (1/Z Would Blow Up Or Flip Sign)
 
     // Calculate 2D Point
     XYResult xy = calc_2d(xyz.x, xyz.y, xyz.z);
 
     rdp_set_blend_color(col[c], col[c + 1], col[c + 2], col[c + 3]); // Set Blend Color: R,G,B,A
-    rdp_set_prim_depth(xyz.z,0); // Set Primitive Depth: Primitive Z,Primitive Delta Z
+    rdp_set_prim_depth(depth_3d(1.0 / xyz.z),0); // Set Primitive Depth: Primitive Z,Primitive Delta Z
     rdp_fill_rectangle( xy.x,xy.y, xy.x + size,xy.y + size ); // Fill Rectangle: XH,YH, XL,YL
-    rdp_sync_pipe(); // Stall Pipeline, Until Preceeding Primitives Completely Finish
   }
 }
 
@@ -113,13 +599,23 @@ void fill_triangle_array( float vert[], uint8_t col[], uint8_t cull, uint32_t ba
     XYResult xy2 = calc_2d(xyz2.x, xyz2.y, xyz2.z);
     XYResult xy3 = calc_2d(xyz3.x, xyz3.y, xyz3.z);
 
+    // Trivially Reject Off Screen Triangles, Clip Triangles Crossing The Near Plane (Or Leaving The Guard Band) & Draw The Result As A Fan
+    uint8_t test = clip_test(clip_code(xyz1.z, xy1), clip_code(xyz2.z, xy2), clip_code(xyz3.z, xy3));
+    if (test == TRI_REJECT) continue;
+    if (test == TRI_CLIP) {
+      ClipPoint3D poly[CLIP_MAX_VERTS];
+      uint8_t count = clip_triangle(xyz1, xyz2, xyz3, NULL, NULL, cull, poly);
+      if (count) rdp_set_blend_color(col[c], col[c + 1], col[c + 2], col[c + 3]); // Set Blend Color: R,G,B,A
+      for(uint8_t k = 2; k < count; k++) rdp_draw_fill_triangle( poly[0].x,poly[0].y, poly[k - 1].x,poly[k - 1].y, poly[k].x,poly[k].y ); // Draw Fan Triangle: X1,Y1, X2,Y2, X3,Y3
+      continue;
+    }
+
     // Test Polygon Winding Direction (IF Triangle Winding > 0.0: Clockwise ELSE: Anti-Clockwise)
     int winding = poly_winding(xy1.x,xy1.y, xy2.x,xy2.y, xy3.x,xy3.y);
 
     if((cull == CULL_NONE) || ((winding <= 0) && (cull == CULL_BACK)) || ((winding > 0) && (cull == CULL_FRONT))) {
       rdp_set_blend_color(col[c], col[c + 1], col[c + 2], col[c + 3]); // Set Blend Color: R,G,B,A
       rdp_draw_fill_triangle( xy1.x,xy1.y, xy2.x,xy2.y, xy3.x,xy3.y ); // Draw Fill Triangle: X1,Y1, X2,Y2, X3,Y3
-      rdp_sync_pipe(); // Stall Pipeline, Until Preceeding Primitives Completely Finish
     }
   }
 }
@@ -138,13 +634,174 @@ void fill_zbuffer_triangle_array( float vert[], uint8_t col[], uint8_t cull, uin
     XYResult xy2 = calc_2d(xyz2.x, xyz2.y, xyz2.z);
     XYResult xy3 = calc_2d(xyz3.x, xyz3.y, xyz3.z);
 
+    // Trivially Reject Off Screen Triangles, Clip Triangles Crossing The Near Plane (Or Leaving The Guard Band) & Draw The Result As A Fan
+    uint8_t test = clip_test(clip_code(xyz1.z, xy1), clip_code(xyz2.z, xy2), clip_code(xyz3.z, xy3));
+    if (test == TRI_REJECT) continue;
+    if (test == TRI_CLIP) {
+      ClipPoint3D poly[CLIP_MAX_VERTS];
+      uint8_t count = clip_triangle(xyz1, xyz2, xyz3, NULL, NULL, cull, poly);
+      if (count) rdp_set_blend_color(col[c], col[c + 1], col[c + 2], col[c + 3]); // Set Blend Color: R,G,B,A
+      for(uint8_t k = 2; k < count; k++) rdp_draw_fill_zbuffer_triangle( poly[0].x,poly[0].y,depth_3d(poly[0].inv_w), poly[k - 1].x,poly[k - 1].y,depth_3d(poly[k - 1].inv_w), poly[k].x,poly[k].y,depth_3d(poly[k].inv_w) ); // Draw Fan Triangle: X1,Y1,Z1 X2,Y2,Z2 X3,Y3,Z3
+      continue;
+    }
+
     // Test Polygon Winding Direction (IF Triangle Winding > 0.0: Clockwise ELSE: Anti-Clockwise)
     int winding = poly_winding(xy1.x,xy1.y, xy2.x,xy2.y, xy3.x,xy3.y);
 
     if((cull == CULL_NONE) || ((winding <= 0) && (cull == CULL_BACK)) || ((winding > 0) && (cull == CULL_FRONT))) {
+      // Accepted By clip_test: Every Vertex Is At Or Beyond The Near Plane (clip_code Flags Z < NEAR_3D), So 1/Z Is Finite & Positive
       rdp_set_blend_color(col[c], col[c + 1], col[c + 2], col[c + 3]); // Set Blend Color: R,G,B,A
-      rdp_draw_fill_zbuffer_triangle( xy1.x,xy1.y,xyz1.z, xy2.x,xy2.y,xyz2.z, xy3.x,xy3.y,xyz3.z ); // Draw Fill Triangle: X1,Y1,Z1 X2,Y2,Z2 X3,Y3,Z3
-      rdp_sync_pipe(); // Stall Pipeline, Until Preceeding Primitives Completely Finish
+      rdp_draw_fill_zbuffer_triangle( xy1.x,xy1.y,depth_3d(1.0 / xyz1.z), xy2.x,xy2.y,depth_3d(1.0 / xyz2.z), xy3.x,xy3.y,depth_3d(1.0 / xyz3.z) ); // Draw Fill Triangle: X1,Y1,Z1 X2,Y2,Z2 X3,Y3,Z3
+    }
+  }
+}
+
+// Fill Mesh: Mesh, Culling
+void fill_mesh( Mesh3D *mesh, uint8_t cull )
+{
+  if (!cull_mesh(mesh, cull)) return; // Every Face Culled (Or Mesh Too Large)
+  transform_mesh(mesh);
+
+  for(uint32_t t = 0, i = 0, c = 0; t < mesh->tri_count; t++, i += 3, c += 4) {
+    if (!MeshFaceVisible[t]) continue; // Culled In Object Space
+
+    // Trivially Reject Off Screen Faces, Clip Faces Crossing The Near Plane (Or Leaving The Guard Band) & Draw The Result As A Fan
+    uint8_t test = clip_test(MeshClip[mesh->index[i]], MeshClip[mesh->index[i + 1]], MeshClip[mesh->index[i + 2]]);
+    if (test == TRI_REJECT) continue;
+    if (test == TRI_CLIP) {
+      ClipPoint3D poly[CLIP_MAX_VERTS];
+      uint8_t count = clip_mesh_face(mesh, i, cull, poly);
+      if (count) rdp_set_blend_color(mesh->col[c], mesh->col[c + 1], mesh->col[c + 2], mesh->col[c + 3]); // Set Blend Color: R,G,B,A
+      for(uint8_t k = 2; k < count; k++) rdp_draw_fill_triangle( poly[0].x,poly[0].y, poly[k - 1].x,poly[k - 1].y, poly[k].x,poly[k].y ); // Draw Fan Triangle: X1,Y1, X2,Y2, X3,Y3
+      continue;
+    }
+
+#if FIXED_3D
+    XYFixed xy1 = MeshXYFixed[mesh->index[i]];
+    XYFixed xy2 = MeshXYFixed[mesh->index[i + 1]];
+    XYFixed xy3 = MeshXYFixed[mesh->index[i + 2]];
+
+    // Test Polygon Winding Direction (IF Triangle Winding > 0: Clockwise ELSE: Anti-Clockwise)
+    int winding = (mesh->normal != NULL) ? 0 : (xy3.x - xy1.x) * (xy2.y - xy1.y) - (xy3.y - xy1.y) * (xy2.x - xy1.x);
+#else
+    XYResult xy1 = MeshXY[mesh->index[i]];
+    XYResult xy2 = MeshXY[mesh->index[i + 1]];
+    XYResult xy3 = MeshXY[mesh->index[i + 2]];
+
+    // Test Polygon Winding Direction (IF Triangle Winding > 0.0: Clockwise ELSE: Anti-Clockwise)
+    int winding = (mesh->normal != NULL) ? 0 : poly_winding(xy1.x,xy1.y, xy2.x,xy2.y, xy3.x,xy3.y);
+#endif
+
+    if((cull == CULL_NONE) || (mesh->normal != NULL) || ((winding <= 0) && (cull == CULL_BACK)) || ((winding > 0) && (cull == CULL_FRONT))) {
+      rdp_set_blend_color(mesh->col[c], mesh->col[c + 1], mesh->col[c + 2], mesh->col[c + 3]); // Set Blend Color: R,G,B,A
+#if FIXED_3D
+      rdp_draw_fill_triangle_fx( xy1.x * 4,xy1.y * 4, xy2.x * 4,xy2.y * 4, xy3.x * 4,xy3.y * 4 ); // Draw Fill Triangle (S11.2): X1,Y1, X2,Y2, X3,Y3
+#else
+      rdp_draw_fill_triangle( xy1.x,xy1.y, xy2.x,xy2.y, xy3.x,xy3.y ); // Draw Fill Triangle: X1,Y1, X2,Y2, X3,Y3
+#endif
+    }
+  }
+}
+
+// Fill Z-Buffer Mesh: Mesh, Culling
+void fill_zbuffer_mesh( Mesh3D *mesh, uint8_t cull )
+{
+  if (!cull_mesh(mesh, cull)) return; // Every Face Culled (Or Mesh Too Large)
+  transform_mesh(mesh);
+
+  for(uint32_t t = 0, i = 0, c = 0; t < mesh->tri_count; t++, i += 3, c += 4) {
+    if (!MeshFaceVisible[t]) continue; // Culled In Object Space
+
+    // Trivially Reject Off Screen Faces, Clip Faces Crossing The Near Plane (Or Leaving The Guard Band) & Draw The Result As A Fan
+    uint8_t test = clip_test(MeshClip[mesh->index[i]], MeshClip[mesh->index[i + 1]], MeshClip[mesh->index[i + 2]]);
+    if (test == TRI_REJECT) continue;
+    if (test == TRI_CLIP) {
+      ClipPoint3D poly[CLIP_MAX_VERTS];
+      uint8_t count = clip_mesh_face(mesh, i, cull, poly);
+      if (count) rdp_set_blend_color(mesh->col[c], mesh->col[c + 1], mesh->col[c + 2], mesh->col[c + 3]); // Set Blend Color: R,G,B,A
+      for(uint8_t k = 2; k < count; k++) rdp_draw_fill_zbuffer_triangle( poly[0].x,poly[0].y,depth_3d(poly[0].inv_w), poly[k - 1].x,poly[k - 1].y,depth_3d(poly[k - 1].inv_w), poly[k].x,poly[k].y,depth_3d(poly[k].inv_w) ); // Draw Fan Triangle: X1,Y1,Z1 X2,Y2,Z2 X3,Y3,Z3
+      continue;
+    }
+
+    uint16_t i1 = mesh->index[i], i2 = mesh->index[i + 1], i3 = mesh->index[i + 2];
+    XYResult xy1 = MeshXY[i1], xy2 = MeshXY[i2], xy3 = MeshXY[i3];
+
+    // Test Polygon Winding Direction (IF Triangle Winding > 0.0: Clockwise ELSE: Anti-Clockwise)
+    int winding = (mesh->normal != NULL) ? 0 : poly_winding(xy1.x,xy1.y, xy2.x,xy2.y, xy3.x,xy3.y);
+
+    if((cull == CULL_NONE) || (mesh->normal != NULL) || ((winding <= 0) && (cull == CULL_BACK)) || ((winding > 0) && (cull == CULL_FRONT))) {
+      rdp_set_blend_color(mesh->col[c], mesh->col[c + 1], mesh->col[c + 2], mesh->col[c + 3]); // Set Blend Color: R,G,B,A
+      rdp_draw_fill_zbuffer_triangle( xy1.x,xy1.y,depth_3d(MeshInvW[i1]), xy2.x,xy2.y,depth_3d(MeshInvW[i2]), xy3.x,xy3.y,depth_3d(MeshInvW[i3]) ); // Draw Fill Triangle: X1,Y1,Z1 X2,Y2,Z2 X3,Y3,Z3
+    }
+  }
+}
+
+// Fill Shade Triangle Array: Vert Array, Color Array (R,G,B,A Per Corner), Culling, Base, Length
+void fill_shade_triangle_array( float vert[], uint8_t col[], uint8_t cull, uint32_t base, uint32_t length)
+{
+  for(uint32_t v = base, c = (base / 9) * 12; v < (base + length); v += 9, c += 12) {
+    // Calculate 3D Points
+    XYZResult xyz1 = calc_3d(Matrix3D, vert[v], vert[v + 1], vert[v + 2]);
+    XYZResult xyz2 = calc_3d(Matrix3D, vert[v + 3], vert[v + 4], vert[v + 5]);
+    XYZResult xyz3 = calc_3d(Matrix3D, vert[v + 6], vert[v + 7], vert[v + 8]);
+
+    // Calculate 2D Points
+    XYResult xy1 = calc_2d(xyz1.x, xyz1.y, xyz1.z);
+    XYResult xy2 = calc_2d(xyz2.x, xyz2.y, xyz2.z);
+    XYResult xy3 = calc_2d(xyz3.x, xyz3.y, xyz3.z);
+
+    // Trivially Reject Off Screen Triangles, Clip Triangles Crossing The Near Plane (Or Leaving The Guard Band) & Draw The Result As A Fan
+    uint8_t test = clip_test(clip_code(xyz1.z, xy1), clip_code(xyz2.z, xy2), clip_code(xyz3.z, xy3));
+    if (test == TRI_REJECT) continue;
+    if (test == TRI_CLIP) {
+      ClipPoint3D poly[CLIP_MAX_VERTS];
+      uint8_t count = clip_triangle(xyz1, xyz2, xyz3, NULL, &col[c], cull, poly);
+      for(uint8_t k = 2; k < count; k++) rdp_draw_shade_triangle( poly[0].x,poly[0].y,poly[0].r,poly[0].g,poly[0].b,poly[0].a, poly[k - 1].x,poly[k - 1].y,poly[k - 1].r,poly[k - 1].g,poly[k - 1].b,poly[k - 1].a, poly[k].x,poly[k].y,poly[k].r,poly[k].g,poly[k].b,poly[k].a ); // Draw Fan Triangle: X,Y,R,G,B,A Per Point
+      continue;
+    }
+
+    // Test Polygon Winding Direction (IF Triangle Winding > 0.0: Clockwise ELSE: Anti-Clockwise)
+    int winding = poly_winding(xy1.x,xy1.y, xy2.x,xy2.y, xy3.x,xy3.y);
+
+    if((cull == CULL_NONE) || ((winding <= 0) && (cull == CULL_BACK)) || ((winding > 0) && (cull == CULL_FRONT))) {
+      rdp_draw_shade_triangle( xy1.x,xy1.y,col[c],col[c + 1],col[c + 2],col[c + 3], xy2.x,xy2.y,col[c + 4],col[c + 5],col[c + 6],col[c + 7], xy3.x,xy3.y,col[c + 8],col[c + 9],col[c + 10],col[c + 11] ); // Draw Shade Triangle: X,Y,R,G,B,A Per Point
+    }
+  }
+}
+
+// Fill Shade Mesh: Mesh, Culling (Gouraud Shaded From The Vertex Colors, Or Flat Face Colors When There Are None; Each Unique Vertex Transformed Once)
+void fill_shade_mesh( Mesh3D *mesh, uint8_t cull )
+{
+  if (!cull_mesh(mesh, cull)) return; // Every Face Culled (Or Mesh Too Large)
+  transform_mesh(mesh);
+
+  for(uint32_t t = 0, i = 0; t < mesh->tri_count; t++, i += 3) {
+    if (!MeshFaceVisible[t]) continue; // Culled In Object Space
+
+    // Trivially Reject Off Screen Faces, Clip Faces Crossing The Near Plane (Or Leaving The Guard Band) & Draw The Result As A Fan
+    uint8_t test = clip_test(MeshClip[mesh->index[i]], MeshClip[mesh->index[i + 1]], MeshClip[mesh->index[i + 2]]);
+    if (test == TRI_REJECT) continue;
+    if (test == TRI_CLIP) {
+      ClipPoint3D poly[CLIP_MAX_VERTS];
+      uint8_t count = clip_mesh_face(mesh, i, cull, poly);
+      for(uint8_t k = 2; k < count; k++) rdp_draw_shade_triangle( poly[0].x,poly[0].y,poly[0].r,poly[0].g,poly[0].b,poly[0].a, poly[k - 1].x,poly[k - 1].y,poly[k - 1].r,poly[k - 1].g,poly[k - 1].b,poly[k - 1].a, poly[k].x,poly[k].y,poly[k].r,poly[k].g,poly[k].b,poly[k].a ); // Draw Fan Triangle: X,Y,R,G,B,A Per Point
+      continue;
+    }
+
+    uint16_t i1 = mesh->index[i], i2 = mesh->index[i + 1], i3 = mesh->index[i + 2];
+    XYResult xy1 = MeshXY[i1], xy2 = MeshXY[i2], xy3 = MeshXY[i3];
+    uint8_t *c1 = &mesh->col[t * 4], *c2 = c1, *c3 = c1; // No Vertex Colors: Flat Face Color At Every Corner
+    if (mesh->vert_col != NULL) {
+      c1 = &mesh->vert_col[i1 * 4];
+      c2 = &mesh->vert_col[i2 * 4];
+      c3 = &mesh->vert_col[i3 * 4];
+    }
+
+    // Test Polygon Winding Direction (IF Triangle Winding > 0.0: Clockwise ELSE: Anti-Clockwise)
+    int winding = (mesh->normal != NULL) ? 0 : poly_winding(xy1.x,xy1.y, xy2.x,xy2.y, xy3.x,xy3.y);
+
+    if((cull == CULL_NONE) || (mesh->normal != NULL) || ((winding <= 0) && (cull == CULL_BACK)) || ((winding > 0) && (cull == CULL_FRONT))) {
+      rdp_draw_shade_triangle( xy1.x,xy1.y,c1[0],c1[1],c1[2],c1[3], xy2.x,xy2.y,c2[0],c2[1],c2[2],c2[3], xy3.x,xy3.y,c3[0],c3[1],c3[2],c3[3] ); // Draw Shade Triangle: X,Y,R,G,B,A Per Point
     }
   }
 }
@@ -175,40 +832,63 @@ void translate_xyz( float matrix[], float x, float y, float z )
   matrix[11] = z;
 }
 
+// Quarter Wave Sine: Quarter Table, Angle (1024 = 360 Degrees), Returns Q1.14
+static inline int32_t quarter_sin_q14( const int16_t table[], uint16_t a )
+{
+  // Branchless (Angles Arrive In No Particular Order): Masks Are All Ones In The Quarters They Apply To
+  int32_t mirror = -(int32_t)((a >> 8) & 1); // Second & Fourth Quarters Mirror The First: Index 256 - (A & 255)
+  int32_t negate = -(int32_t)((a >> 9) & 1); // Third & Fourth Quarters Are Negative
+  int32_t i = (a & 255) ^ mirror;
+  int32_t s = table[(i - mirror) + (256 & mirror)];
+  return (s ^ negate) - negate;
+}
+
+// Quarter Wave Sine: Quarter Table, Angle (1024 = 360 Degrees)
+static inline float quarter_sin( const int16_t table[], uint16_t a )
+{
+  return quarter_sin_q14(table, a) * (float)(1.0 / 16384.0);
+}
+
+// Quarter Wave Cosine: Quarter Table, Angle (1024 = 360 Degrees)
+static inline float quarter_cos( const int16_t table[], uint16_t a )
+{
+  return quarter_sin_q14(table, a + 256) * (float)(1.0 / 16384.0);
+}
+
 // Rotate: Matrix, Precalc Table, X
-void rotate_x( float matrix[], float precalc[], uint16_t x )
+void rotate_x( float matrix[], const int16_t precalc[], uint16_t x )
 {
-  matrix[5] = precalc[(x + 256) & 1023]; // XC
-  matrix[6] = -precalc[x]; // -XS
+  matrix[5] = quarter_cos(precalc, x); // XC
+  matrix[6] = -quarter_sin(precalc, x); // -XS
   matrix[9] = -matrix[6]; // XS
   matrix[10] = matrix[5]; // XC
 }
 
 // Rotate: Matrix, Precalc Table, Y
-void rotate_y( float matrix[], float precalc[], uint16_t y )
+void rotate_y( float matrix[], const int16_t precalc[], uint16_t y )
 {
-  matrix[0] = precalc[(y + 256) & 1023]; // YC
-  matrix[8] = -precalc[y]; // -YS
+  matrix[0] = quarter_cos(precalc, y); // YC
+  matrix[8] = -quarter_sin(precalc, y); // -YS
   matrix[2] = -matrix[8]; // YS
   matrix[10] = matrix[0]; // YC
 }
 
 // Rotate: Matrix, Precalc Table, Z
-void rotate_z( float matrix[], float precalc[], uint16_t z )
+void rotate_z( float matrix[], const int16_t precalc[], uint16_t z )
 {
-  matrix[0] = precalc[(z + 256) & 1023]; // ZC
-  matrix[1] = -precalc[z]; // -ZS
+  matrix[0] = quarter_cos(precalc, z); // ZC
+  matrix[1] = -quarter_sin(precalc, z); // -ZS
   matrix[4] = -matrix[1]; // ZS
   matrix[5] = matrix[0]; // ZC
 }
 
 // Rotate: Matrix, Precalc Table, X, Y
-void rotate_xy( float matrix[], float precalc[], uint16_t x, uint16_t y )
+void rotate_xy( float matrix[], const int16_t precalc[], uint16_t x, uint16_t y )
 {
-  matrix[5] = precalc[(x + 256) & 1023]; // XC
-  matrix[6] = precalc[x]; // XS
-  matrix[0] = precalc[(y + 256) & 1023]; // YC
-  matrix[8] = precalc[y]; // YS
+  matrix[5] = quarter_cos(precalc, x); // XC
+  matrix[6] = quarter_sin(precalc, x); // XS
+  matrix[0] = quarter_cos(precalc, y); // YC
+  matrix[8] = quarter_sin(precalc, y); // YS
   matrix[1] = matrix[6] * matrix[8]; // XS * YS
   matrix[2] = -matrix[5] * matrix[8]; // -XC * YS
   matrix[9] = -matrix[6] * matrix[0]; // -XS * YC
@@ -216,12 +896,12 @@ void rotate_xy( float matrix[], float precalc[], uint16_t x, uint16_t y )
 }
 
 // Rotate: Matrix, Precalc Table, X, Z
-void rotate_xz( float matrix[], float precalc[], uint16_t x, uint16_t z )
+void rotate_xz( float matrix[], const int16_t precalc[], uint16_t x, uint16_t z )
 {
-  matrix[10] = precalc[(x + 256) & 1023]; // XC
-  matrix[6] = precalc[x]; // XS
-  matrix[0] = precalc[(z + 256) & 1023]; // ZC
-  matrix[1] = precalc[z]; // ZS
+  matrix[10] = quarter_cos(precalc, x); // XC
+  matrix[6] = quarter_sin(precalc, x); // XS
+  matrix[0] = quarter_cos(precalc, z); // ZC
+  matrix[1] = quarter_sin(precalc, z); // ZS
   matrix[4] = matrix[10] * -matrix[1]; // XC * -ZS
   matrix[5] = matrix[10] * matrix[0]; // XC * ZC
   matrix[8] = matrix[6] * matrix[1]; // XS * ZS
@@ -229,12 +909,12 @@ void rotate_xz( float matrix[], float precalc[], uint16_t x, uint16_t z )
 }
 
 // Rotate: Matrix, Precalc Table, Y, Z
-void rotate_yz( float matrix[], float precalc[], uint16_t y, uint16_t z )
+void rotate_yz( float matrix[], const int16_t precalc[], uint16_t y, uint16_t z )
 {
-  matrix[10] = precalc[(y + 256) & 1023]; // YC
-  matrix[8] = precalc[y]; // YS
-  matrix[5] = precalc[(z + 256) & 1023]; // ZC
-  matrix[1] = precalc[z]; // ZS
+  matrix[10] = quarter_cos(precalc, y); // YC
+  matrix[8] = quarter_sin(precalc, y); // YS
+  matrix[5] = quarter_cos(precalc, z); // ZC
+  matrix[1] = quarter_sin(precalc, z); // ZS
   matrix[0] = matrix[10] * matrix[5]; // YC * ZC
   matrix[2] = matrix[8] * -matrix[5]; // YS * -ZC
   matrix[4] = matrix[10] * -matrix[1]; // YC * -ZS
@@ -242,14 +922,14 @@ void rotate_yz( float matrix[], float precalc[], uint16_t y, uint16_t z )
 }
 
 // Rotate: Matrix, Precalc Table, X, Y, Z
-void rotate_xyz( float matrix[], float precalc[], uint16_t x, uint16_t y, uint16_t z )
+void rotate_xyz( float matrix[], const int16_t precalc[], uint16_t x, uint16_t y, uint16_t z )
 {
-  matrix[1] = precalc[(x + 256) & 1023]; // XC
-  matrix[6] = precalc[x]; // XS
-  matrix[10] = precalc[(y + 256) & 1023]; // YC
-  matrix[2] = precalc[y]; // YS
-  matrix[8] = precalc[(z + 256) & 1023]; // ZC
-  matrix[9] = precalc[z]; // ZS
+  matrix[1] = quarter_cos(precalc, x); // XC
+  matrix[6] = quarter_sin(precalc, x); // XS
+  matrix[10] = quarter_cos(precalc, y); // YC
+  matrix[2] = quarter_sin(precalc, y); // YS
+  matrix[8] = quarter_cos(precalc, z); // ZC
+  matrix[9] = quarter_sin(precalc, z); // ZS
   matrix[5] = -matrix[6] * matrix[10]; // -XS * YC
   matrix[4] = (matrix[5] * matrix[8]) - (matrix[1] * matrix[9]); // (-XS * YC * ZC) - (XC * ZS)
   matrix[5] = (matrix[5] * matrix[9]) + (matrix[1] * matrix[8]); // (-XS * YC * ZS) + (XC * ZC)
@@ -259,1032 +939,417 @@ void rotate_xyz( float matrix[], float precalc[], uint16_t x, uint16_t y, uint16
   matrix[6] *= matrix[2]; // XS * YS
   matrix[8] *= matrix[2]; // ZC * YS
   matrix[9] *= matrix[2]; // ZS * YS
-  matrix[2] *= -precalc[(x + 256) & 1023]; // -XC * YS
+  matrix[2] *= -quarter_cos(precalc, x); // -XC * YS
+}
+
+// Multiply Matrix: Result, A, B (Result = A * B: B Applies First, Result May Be A Or B)
+void matrix_multiply( float result[], float a[], float b[] )
+{
+  float m[12];
+  for(int r = 0; r < 12; r += 4) {
+    m[r] = (a[r] * b[0]) + (a[r + 1] * b[4]) + (a[r + 2] * b[8]);
+    m[r + 1] = (a[r] * b[1]) + (a[r + 1] * b[5]) + (a[r + 2] * b[9]);
+    m[r + 2] = (a[r] * b[2]) + (a[r + 1] * b[6]) + (a[r + 2] * b[10]);
+    m[r + 3] = (a[r] * b[3]) + (a[r + 1] * b[7]) + (a[r + 2] * b[11]) + a[r + 3]; // Implicit Bottom Row 0, 0, 0, 1
+  }
+  for(int i = 0; i < 12; i++) result[i] = m[i];
+}
+
+// Push Matrix: Save Matrix3D (Returns 0 When The Stack Is Full & Nothing Was Saved)
+int matrix_push( void )
+{
+  if (MatrixStackTop >= MATRIX_STACK_DEPTH) return 0;
+  for(int i = 0; i < 12; i++) MatrixStack[MatrixStackTop][i] = Matrix3D[i];
+  MatrixStackTop++;
+  return 1;
+}
+
+// Pop Matrix: Restore The Last Saved Matrix3D (Returns 0 When The Stack Is Empty)
+int matrix_pop( void )
+{
+  if (MatrixStackTop == 0) return 0;
+  MatrixStackTop--;
+  for(int i = 0; i < 12; i++) Matrix3D[i] = MatrixStack[MatrixStackTop][i];
+  return 1;
+}
+
+// Concatenate Translate: Matrix, X, Y, Z (Matrix = Matrix * Translate)
+void matrix_translate( float matrix[], float x, float y, float z )
+{
+  matrix[3] += (matrix[0] * x) + (matrix[1] * y) + (matrix[2] * z);
+  matrix[7] += (matrix[4] * x) + (matrix[5] * y) + (matrix[6] * z);
+  matrix[11] += (matrix[8] * x) + (matrix[9] * y) + (matrix[10] * z);
+}
+
+// Concatenate Rotate: Matrix, Precalc Table, X (Matrix = Matrix * Rotate)
+void matrix_rotate_x( float matrix[], const int16_t precalc[], uint16_t x )
+{
+  float rotate[12];
+  matrix_identity(rotate);
+  rotate_x(rotate, precalc, x);
+  matrix_multiply(matrix, matrix, rotate);
+}
+
+// Concatenate Rotate: Matrix, Precalc Table, Y (Matrix = Matrix * Rotate)
+void matrix_rotate_y( float matrix[], const int16_t precalc[], uint16_t y )
+{
+  float rotate[12];
+  matrix_identity(rotate);
+  rotate_y(rotate, precalc, y);
+  matrix_multiply(matrix, matrix, rotate);
 }
 
-static float Sin1024[1024] = { // 1024 Rotations (Sin)
-  0.000000000000000000,
-  0.006135884649154475,
-  0.012271538285719925,
-  0.01840672990580482,
-  0.024541228522912288,
-  0.030674803176636626,
-  0.03680722294135883,
-  0.04293825693494082,
-  0.049067674327418015,
-  0.05519524434968994,
-  0.06132073630220858,
-  0.06744391956366405,
-  0.07356456359966743,
-  0.07968243797143013,
-  0.0857973123444399,
-  0.09190895649713272,
-  0.0980171403295606,
-  0.10412163387205459,
-  0.11022220729388306,
-  0.11631863091190475,
-  0.1224106751992162,
-  0.12849811079379317,
-  0.13458070850712617,
-  0.1406582393328492,
-  0.14673047445536175,
-  0.15279718525844344,
-  0.15885814333386145,
-  0.16491312048996992,
-  0.17096188876030122,
-  0.17700422041214875,
-  0.18303988795514095,
-  0.1890686641498062,
-  0.19509032201612825,
-  0.2011046348420919,
-  0.20711137619221856,
-  0.21311031991609136,
-  0.2191012401568698,
-  0.22508391135979283,
-  0.2310581082806711,
-  0.2370236059943672,
-  0.24298017990326387,
-  0.24892760574572015,
-  0.25486565960451457,
-  0.2607941179152755,
-  0.26671275747489837,
-  0.272621355449949,
-  0.27851968938505306,
-  0.2844075372112719,
-  0.29028467725446233,
-  0.2961508882436238,
-  0.3020059493192281,
-  0.30784964004153487,
-  0.3136817403988915,
-  0.3195020308160157,
-  0.3253102921622629,
-  0.33110630575987643,
-  0.33688985339222005,
-  0.3426607173119944,
-  0.34841868024943456,
-  0.35416352542049034,
-  0.3598950365349881,
-  0.36561299780477385,
-  0.3713171939518375,
-  0.37700741021641826,
-  0.3826834323650898,
-  0.38834504669882625,
-  0.3939920400610481,
-  0.3996241998456468,
-  0.40524131400498986,
-  0.4108431710579039,
-  0.41642956009763715,
-  0.4220002707997997,
-  0.4275550934302821,
-  0.43309381885315196,
-  0.43861623853852766,
-  0.4441221445704292,
-  0.44961132965460654,
-  0.45508358712634384,
-  0.46053871095824,
-  0.4659764957679662,
-  0.47139673682599764,
-  0.4767992300633221,
-  0.4821837720791227,
-  0.487550160148436,
-  0.49289819222978404,
-  0.4982276669727818,
-  0.5035383837257176,
-  0.508830142543107,
-  0.5141027441932217,
-  0.5193559901655896,
-  0.524589682678469,
-  0.5298036246862946,
-  0.5349976198870972,
-  0.5401714727298929,
-  0.5453249884220465,
-  0.5504579729366048,
-  0.5555702330196022,
-  0.560661576197336,
-  0.5657318107836131,
-  0.5707807458869673,
-  0.5758081914178453,
-  0.5808139580957645,
-  0.5857978574564389,
-  0.5907597018588742,
-  0.5956993044924334,
-  0.600616479383869,
-  0.6055110414043255,
-  0.6103828062763095,
-  0.6152315905806268,
-  0.6200572117632891,
-  0.6248594881423863,
-  0.629638238914927,
-  0.6343932841636455,
-  0.6391244448637757,
-  0.6438315428897914,
-  0.6485144010221124,
-  0.6531728429537768,
-  0.6578066932970786,
-  0.6624157775901718,
-  0.6669999223036375,
-  0.6715589548470183,
-  0.6760927035753159,
-  0.680600997795453,
-  0.6850836677727004,
-  0.6895405447370668,
-  0.6939714608896539,
-  0.6983762494089729,
-  0.7027547444572253,
-  0.7071067811865475,
-  0.7114321957452164,
-  0.7157308252838186,
-  0.7200025079613817,
-  0.7242470829514669,
-  0.7284643904482252,
-  0.7326542716724128,
-  0.7368165688773698,
-  0.7409511253549591,
-  0.745057785441466,
-  0.7491363945234593,
-  0.7531867990436125,
-  0.7572088465064846,
-  0.7612023854842618,
-  0.765167265622459,
-  0.7691033376455796,
-  0.7730104533627369,
-  0.7768884656732324,
-  0.7807372285720944,
-  0.7845565971555752,
-  0.7883464276266062,
-  0.7921065773002123,
-  0.7958369046088836,
-  0.799537269107905,
-  0.8032075314806448,
-  0.8068475535437992,
-  0.8104571982525948,
-  0.8140363297059483,
-  0.8175848131515837,
-  0.8211025149911046,
-  0.8245893027850253,
-  0.8280450452577558,
-  0.8314696123025452,
-  0.83486287498638,
-  0.838224705554838,
-  0.8415549774368983,
-  0.844853565249707,
-  0.8481203448032971,
-  0.8513551931052652,
-  0.8545579883654005,
-  0.8577286100002721,
-  0.8608669386377673,
-  0.8639728561215867,
-  0.8670462455156926,
-  0.8700869911087113,
-  0.8730949784182901,
-  0.8760700941954066,
-  0.8790122264286334,
-  0.8819212643483549,
-  0.8847970984309378,
-  0.8876396204028539,
-  0.8904487232447579,
-  0.8932243011955153,
-  0.8959662497561851,
-  0.8986744656939538,
-  0.901348847046022,
-  0.9039892931234433,
-  0.9065957045149153,
-  0.9091679830905224,
-  0.9117060320054299,
-  0.9142097557035307,
-  0.9166790599210427,
-  0.9191138516900578,
-  0.9215140393420419,
-  0.9238795325112867,
-  0.9262102421383114,
-  0.9285060804732156,
-  0.9307669610789837,
-  0.9329927988347388,
-  0.9351835099389475,
-  0.937339011912575,
-  0.9394592236021899,
-  0.9415440651830208,
-  0.9435934581619604,
-  0.9456073253805213,
-  0.9475855910177411,
-  0.9495281805930367,
-  0.9514350209690083,
-  0.9533060403541938,
-  0.9551411683057707,
-  0.9569403357322089,
-  0.9587034748958716,
-  0.9604305194155658,
-  0.9621214042690416,
-  0.9637760657954398,
-  0.9653944416976894,
-  0.9669764710448521,
-  0.9685220942744173,
-  0.970031253194544,
-  0.9715038909862518,
-  0.9729399522055601,
-  0.9743393827855759,
-  0.9757021300385286,
-  0.9770281426577544,
-  0.9783173707196277,
-  0.9795697656854405,
-  0.9807852804032304,
-  0.9819638691095552,
-  0.9831054874312163,
-  0.984210092386929,
-  0.9852776423889412,
-  0.9863080972445987,
-  0.9873014181578584,
-  0.9882575677307495,
-  0.989176509964781,
-  0.9900582102622971,
-  0.99090263542778,
-  0.9917097536690995,
-  0.99247953459871,
-  0.9932119492347945,
-  0.9939069700023561,
-  0.9945645707342554,
-  0.9951847266721968,
-  0.9957674144676598,
-  0.996312612182778,
-  0.9968202992911657,
-  0.9972904566786902,
-  0.9977230666441916,
-  0.9981181129001492,
-  0.9984755805732948,
-  0.9987954562051724,
-  0.9990777277526454,
-  0.9993223845883495,
-  0.9995294175010931,
-  0.9996988186962042,
-  0.9998305817958234,
-  0.9999247018391445,
-  0.9999811752826011,
-  1.0000000000000000,
-  0.9999811752826011,
-  0.9999247018391445,
-  0.9998305817958234,
-  0.9996988186962042,
-  0.9995294175010931,
-  0.9993223845883495,
-  0.9990777277526454,
-  0.9987954562051724,
-  0.9984755805732948,
-  0.9981181129001492,
-  0.9977230666441916,
-  0.9972904566786902,
-  0.9968202992911658,
-  0.996312612182778,
-  0.9957674144676598,
-  0.9951847266721969,
-  0.9945645707342554,
-  0.9939069700023561,
-  0.9932119492347945,
-  0.99247953459871,
-  0.9917097536690995,
-  0.99090263542778,
-  0.9900582102622971,
-  0.989176509964781,
-  0.9882575677307495,
-  0.9873014181578584,
-  0.9863080972445987,
-  0.9852776423889412,
-  0.984210092386929,
-  0.9831054874312163,
-  0.9819638691095552,
-  0.9807852804032304,
-  0.9795697656854405,
-  0.9783173707196277,
-  0.9770281426577544,
-  0.9757021300385286,
-  0.9743393827855759,
-  0.9729399522055602,
-  0.9715038909862518,
-  0.970031253194544,
-  0.9685220942744173,
-  0.9669764710448521,
-  0.9653944416976894,
-  0.9637760657954398,
-  0.9621214042690416,
-  0.9604305194155659,
-  0.9587034748958716,
-  0.9569403357322089,
-  0.9551411683057707,
-  0.9533060403541939,
-  0.9514350209690083,
-  0.9495281805930367,
-  0.9475855910177412,
-  0.9456073253805214,
-  0.9435934581619604,
-  0.9415440651830208,
-  0.9394592236021899,
-  0.937339011912575,
-  0.9351835099389476,
-  0.9329927988347388,
-  0.9307669610789837,
-  0.9285060804732156,
-  0.9262102421383114,
-  0.9238795325112867,
-  0.921514039342042,
-  0.9191138516900578,
-  0.9166790599210427,
-  0.9142097557035307,
-  0.9117060320054299,
-  0.9091679830905225,
-  0.9065957045149153,
-  0.9039892931234434,
-  0.901348847046022,
-  0.8986744656939539,
-  0.8959662497561852,
-  0.8932243011955152,
-  0.890448723244758,
-  0.8876396204028539,
-  0.8847970984309379,
-  0.881921264348355,
-  0.8790122264286335,
-  0.8760700941954066,
-  0.8730949784182902,
-  0.8700869911087115,
-  0.8670462455156928,
-  0.8639728561215868,
-  0.8608669386377672,
-  0.8577286100002721,
-  0.8545579883654005,
-  0.8513551931052652,
-  0.8481203448032972,
-  0.8448535652497072,
-  0.8415549774368984,
-  0.8382247055548382,
-  0.8348628749863801,
-  0.8314696123025453,
-  0.8280450452577558,
-  0.8245893027850252,
-  0.8211025149911048,
-  0.8175848131515837,
-  0.8140363297059485,
-  0.8104571982525948,
-  0.8068475535437994,
-  0.8032075314806449,
-  0.7995372691079052,
-  0.7958369046088836,
-  0.7921065773002123,
-  0.7883464276266063,
-  0.7845565971555751,
-  0.7807372285720946,
-  0.7768884656732324,
-  0.7730104533627371,
-  0.7691033376455796,
-  0.7651672656224591,
-  0.7612023854842619,
-  0.7572088465064847,
-  0.7531867990436125,
-  0.7491363945234593,
-  0.7450577854414661,
-  0.740951125354959,
-  0.73681656887737,
-  0.7326542716724128,
-  0.7284643904482253,
-  0.7242470829514669,
-  0.7200025079613818,
-  0.7157308252838187,
-  0.7114321957452167,
-  0.7071067811865476,
-  0.7027547444572252,
-  0.6983762494089729,
-  0.6939714608896539,
-  0.689540544737067,
-  0.6850836677727004,
-  0.6806009977954532,
-  0.6760927035753159,
-  0.6715589548470186,
-  0.6669999223036376,
-  0.662415777590172,
-  0.6578066932970787,
-  0.6531728429537766,
-  0.6485144010221126,
-  0.6438315428897914,
-  0.6391244448637758,
-  0.6343932841636455,
-  0.6296382389149272,
-  0.6248594881423863,
-  0.6200572117632894,
-  0.6152315905806269,
-  0.6103828062763097,
-  0.6055110414043255,
-  0.6006164793838689,
-  0.5956993044924335,
-  0.5907597018588742,
-  0.585797857456439,
-  0.5808139580957645,
-  0.5758081914178454,
-  0.5707807458869673,
-  0.5657318107836135,
-  0.5606615761973361,
-  0.5555702330196022,
-  0.5504579729366049,
-  0.5453249884220464,
-  0.540171472729893,
-  0.5349976198870972,
-  0.5298036246862948,
-  0.524589682678469,
-  0.5193559901655898,
-  0.5141027441932218,
-  0.5088301425431073,
-  0.5035383837257177,
-  0.49822766697278176,
-  0.49289819222978415,
-  0.4875501601484359,
-  0.4821837720791229,
-  0.4767992300633221,
-  0.47139673682599786,
-  0.4659764957679662,
-  0.4605387109582402,
-  0.4550835871263439,
-  0.4496113296546069,
-  0.4441221445704293,
-  0.43861623853852755,
-  0.43309381885315207,
-  0.42755509343028203,
-  0.42200027079979985,
-  0.41642956009763715,
-  0.41084317105790413,
-  0.4052413140049899,
-  0.39962419984564707,
-  0.39399204006104815,
-  0.3883450466988266,
-  0.3826834323650899,
-  0.37700741021641815,
-  0.3713171939518377,
-  0.3656129978047738,
-  0.35989503653498833,
-  0.3541635254204904,
-  0.3484186802494348,
-  0.34266071731199443,
-  0.33688985339222033,
-  0.3311063057598765,
-  0.32531029216226326,
-  0.3195020308160158,
-  0.3136817403988914,
-  0.30784964004153503,
-  0.30200594931922803,
-  0.296150888243624,
-  0.2902846772544624,
-  0.2844075372112721,
-  0.27851968938505317,
-  0.27262135544994925,
-  0.2667127574748985,
-  0.26079411791527585,
-  0.2548656596045147,
-  0.2489276057457201,
-  0.24298017990326407,
-  0.23702360599436717,
-  0.23105810828067133,
-  0.22508391135979283,
-  0.21910124015687005,
-  0.21311031991609142,
-  0.20711137619221884,
-  0.201104634842092,
-  0.1950903220161286,
-  0.18906866414980636,
-  0.1830398879551409,
-  0.17700422041214894,
-  0.17096188876030122,
-  0.16491312048997014,
-  0.15885814333386147,
-  0.15279718525844369,
-  0.1467304744553618,
-  0.14065823933284954,
-  0.13458070850712628,
-  0.12849811079379309,
-  0.12241067519921635,
-  0.11631863091190471,
-  0.11022220729388324,
-  0.10412163387205457,
-  0.09801714032956083,
-  0.09190895649713275,
-  0.08579731234444016,
-  0.0796824379714302,
-  0.07356456359966773,
-  0.06744391956366418,
-  0.06132073630220849,
-  0.055195244349690094,
-  0.049067674327417966,
-  0.04293825693494102,
-  0.03680722294135883,
-  0.030674803176636865,
-  0.024541228522912326,
-  0.0184067299058051,
-  0.012271538285720007,
-  0.006135884649154799,
-  0.000000000000000000,
-  -0.006135884649154554,
-  -0.012271538285719762,
-  -0.01840672990580486,
-  -0.02454122852291208,
-  -0.03067480317663662,
-  -0.03680722294135858,
-  -0.04293825693494078,
-  -0.049067674327417724,
-  -0.05519524434968985,
-  -0.061320736302208245,
-  -0.06744391956366393,
-  -0.0735645635996675,
-  -0.07968243797142995,
-  -0.08579731234443992,
-  -0.09190895649713252,
-  -0.09801714032956059,
-  -0.10412163387205432,
-  -0.110222207293883,
-  -0.11631863091190447,
-  -0.1224106751992161,
-  -0.12849811079379284,
-  -0.13458070850712606,
-  -0.1406582393328493,
-  -0.14673047445536158,
-  -0.15279718525844344,
-  -0.15885814333386122,
-  -0.1649131204899699,
-  -0.17096188876030097,
-  -0.1770042204121487,
-  -0.18303988795514065,
-  -0.1890686641498061,
-  -0.19509032201612836,
-  -0.20110463484209176,
-  -0.2071113761922186,
-  -0.2131103199160912,
-  -0.2191012401568698,
-  -0.2250839113597926,
-  -0.23105810828067108,
-  -0.23702360599436695,
-  -0.24298017990326382,
-  -0.24892760574571987,
-  -0.25486565960451446,
-  -0.2607941179152756,
-  -0.26671275747489825,
-  -0.27262135544994903,
-  -0.2785196893850529,
-  -0.2844075372112718,
-  -0.2902846772544621,
-  -0.2961508882436238,
-  -0.3020059493192278,
-  -0.3078496400415348,
-  -0.3136817403988912,
-  -0.3195020308160156,
-  -0.325310292162263,
-  -0.33110630575987626,
-  -0.33688985339222005,
-  -0.3426607173119942,
-  -0.34841868024943456,
-  -0.3541635254204901,
-  -0.3598950365349881,
-  -0.3656129978047736,
-  -0.37131719395183743,
-  -0.3770074102164179,
-  -0.38268343236508967,
-  -0.38834504669882636,
-  -0.39399204006104793,
-  -0.39962419984564684,
-  -0.4052413140049897,
-  -0.4108431710579039,
-  -0.41642956009763693,
-  -0.4220002707997996,
-  -0.4275550934302818,
-  -0.43309381885315185,
-  -0.4386162385385273,
-  -0.4441221445704291,
-  -0.44961132965460665,
-  -0.45508358712634367,
-  -0.46053871095824006,
-  -0.46597649576796596,
-  -0.47139673682599764,
-  -0.4767992300633219,
-  -0.48218377207912266,
-  -0.48755016014843566,
-  -0.4928981922297839,
-  -0.49822766697278154,
-  -0.5035383837257175,
-  -0.5088301425431071,
-  -0.5141027441932216,
-  -0.5193559901655895,
-  -0.5245896826784687,
-  -0.5298036246862946,
-  -0.5349976198870969,
-  -0.5401714727298929,
-  -0.5453249884220461,
-  -0.5504579729366047,
-  -0.555570233019602,
-  -0.5606615761973359,
-  -0.5657318107836132,
-  -0.5707807458869671,
-  -0.5758081914178453,
-  -0.5808139580957643,
-  -0.5857978574564389,
-  -0.5907597018588739,
-  -0.5956993044924332,
-  -0.6006164793838686,
-  -0.6055110414043254,
-  -0.6103828062763095,
-  -0.6152315905806267,
-  -0.6200572117632892,
-  -0.6248594881423862,
-  -0.629638238914927,
-  -0.6343932841636453,
-  -0.6391244448637757,
-  -0.6438315428897913,
-  -0.6485144010221123,
-  -0.6531728429537765,
-  -0.6578066932970785,
-  -0.6624157775901718,
-  -0.6669999223036374,
-  -0.6715589548470184,
-  -0.6760927035753158,
-  -0.680600997795453,
-  -0.6850836677727001,
-  -0.6895405447370668,
-  -0.6939714608896538,
-  -0.6983762494089728,
-  -0.7027547444572251,
-  -0.7071067811865475,
-  -0.7114321957452164,
-  -0.7157308252838185,
-  -0.7200025079613817,
-  -0.7242470829514668,
-  -0.7284643904482252,
-  -0.7326542716724127,
-  -0.7368165688773698,
-  -0.7409511253549589,
-  -0.7450577854414658,
-  -0.749136394523459,
-  -0.7531867990436124,
-  -0.7572088465064842,
-  -0.761202385484262,
-  -0.765167265622459,
-  -0.7691033376455795,
-  -0.7730104533627367,
-  -0.7768884656732326,
-  -0.7807372285720944,
-  -0.784556597155575,
-  -0.7883464276266059,
-  -0.7921065773002124,
-  -0.7958369046088835,
-  -0.7995372691079048,
-  -0.803207531480645,
-  -0.8068475535437992,
-  -0.8104571982525947,
-  -0.8140363297059481,
-  -0.8175848131515838,
-  -0.8211025149911046,
-  -0.8245893027850251,
-  -0.8280450452577555,
-  -0.8314696123025452,
-  -0.8348628749863799,
-  -0.8382247055548379,
-  -0.8415549774368986,
-  -0.8448535652497071,
-  -0.8481203448032971,
-  -0.8513551931052649,
-  -0.8545579883654005,
-  -0.857728610000272,
-  -0.8608669386377671,
-  -0.8639728561215865,
-  -0.8670462455156926,
-  -0.8700869911087113,
-  -0.8730949784182899,
-  -0.8760700941954067,
-  -0.8790122264286334,
-  -0.8819212643483549,
-  -0.8847970984309376,
-  -0.887639620402854,
-  -0.8904487232447579,
-  -0.8932243011955152,
-  -0.8959662497561849,
-  -0.8986744656939538,
-  -0.9013488470460219,
-  -0.9039892931234431,
-  -0.9065957045149154,
-  -0.9091679830905224,
-  -0.9117060320054298,
-  -0.9142097557035305,
-  -0.9166790599210427,
-  -0.9191138516900577,
-  -0.9215140393420418,
-  -0.9238795325112865,
-  -0.9262102421383114,
-  -0.9285060804732155,
-  -0.9307669610789836,
-  -0.932992798834739,
-  -0.9351835099389476,
-  -0.9373390119125748,
-  -0.9394592236021897,
-  -0.9415440651830208,
-  -0.9435934581619603,
-  -0.9456073253805212,
-  -0.9475855910177412,
-  -0.9495281805930367,
-  -0.9514350209690083,
-  -0.9533060403541938,
-  -0.9551411683057708,
-  -0.9569403357322088,
-  -0.9587034748958715,
-  -0.9604305194155657,
-  -0.9621214042690416,
-  -0.9637760657954398,
-  -0.9653944416976893,
-  -0.9669764710448522,
-  -0.9685220942744173,
-  -0.970031253194544,
-  -0.9715038909862517,
-  -0.9729399522055602,
-  -0.9743393827855759,
-  -0.9757021300385285,
-  -0.9770281426577543,
-  -0.9783173707196277,
-  -0.9795697656854405,
-  -0.9807852804032303,
-  -0.9819638691095554,
-  -0.9831054874312163,
-  -0.984210092386929,
-  -0.9852776423889411,
-  -0.9863080972445987,
-  -0.9873014181578583,
-  -0.9882575677307495,
-  -0.9891765099647809,
-  -0.9900582102622971,
-  -0.99090263542778,
-  -0.9917097536690995,
-  -0.9924795345987101,
-  -0.9932119492347945,
-  -0.9939069700023561,
-  -0.9945645707342554,
-  -0.9951847266721969,
-  -0.9957674144676598,
-  -0.996312612182778,
-  -0.9968202992911657,
-  -0.9972904566786902,
-  -0.9977230666441916,
-  -0.9981181129001492,
-  -0.9984755805732948,
-  -0.9987954562051724,
-  -0.9990777277526454,
-  -0.9993223845883494,
-  -0.9995294175010931,
-  -0.9996988186962042,
-  -0.9998305817958234,
-  -0.9999247018391445,
-  -0.9999811752826011,
-  -1.0000000000000000,
-  -0.9999811752826011,
-  -0.9999247018391445,
-  -0.9998305817958234,
-  -0.9996988186962042,
-  -0.9995294175010931,
-  -0.9993223845883495,
-  -0.9990777277526454,
-  -0.9987954562051724,
-  -0.9984755805732948,
-  -0.9981181129001492,
-  -0.9977230666441916,
-  -0.9972904566786902,
-  -0.9968202992911657,
-  -0.996312612182778,
-  -0.9957674144676598,
-  -0.9951847266721969,
-  -0.9945645707342554,
-  -0.9939069700023561,
-  -0.9932119492347946,
-  -0.9924795345987101,
-  -0.9917097536690995,
-  -0.99090263542778,
-  -0.9900582102622971,
-  -0.9891765099647809,
-  -0.9882575677307495,
-  -0.9873014181578584,
-  -0.9863080972445988,
-  -0.9852776423889412,
-  -0.9842100923869291,
-  -0.9831054874312164,
-  -0.9819638691095554,
-  -0.9807852804032304,
-  -0.9795697656854405,
-  -0.9783173707196278,
-  -0.9770281426577543,
-  -0.9757021300385286,
-  -0.974339382785576,
-  -0.9729399522055603,
-  -0.9715038909862518,
-  -0.970031253194544,
-  -0.9685220942744174,
-  -0.9669764710448523,
-  -0.9653944416976894,
-  -0.96377606579544,
-  -0.9621214042690417,
-  -0.9604305194155658,
-  -0.9587034748958716,
-  -0.9569403357322089,
-  -0.9551411683057709,
-  -0.9533060403541938,
-  -0.9514350209690084,
-  -0.9495281805930368,
-  -0.9475855910177413,
-  -0.9456073253805213,
-  -0.9435934581619604,
-  -0.9415440651830209,
-  -0.9394592236021898,
-  -0.937339011912575,
-  -0.9351835099389477,
-  -0.9329927988347391,
-  -0.9307669610789837,
-  -0.9285060804732156,
-  -0.9262102421383115,
-  -0.9238795325112866,
-  -0.9215140393420419,
-  -0.9191138516900579,
-  -0.9166790599210428,
-  -0.9142097557035306,
-  -0.9117060320054299,
-  -0.9091679830905225,
-  -0.9065957045149156,
-  -0.9039892931234433,
-  -0.901348847046022,
-  -0.898674465693954,
-  -0.895966249756185,
-  -0.8932243011955153,
-  -0.890448723244758,
-  -0.8876396204028542,
-  -0.8847970984309377,
-  -0.881921264348355,
-  -0.8790122264286336,
-  -0.8760700941954069,
-  -0.8730949784182901,
-  -0.8700869911087115,
-  -0.8670462455156929,
-  -0.8639728561215866,
-  -0.8608669386377673,
-  -0.8577286100002722,
-  -0.8545579883654008,
-  -0.8513551931052651,
-  -0.8481203448032973,
-  -0.8448535652497072,
-  -0.8415549774368988,
-  -0.838224705554838,
-  -0.8348628749863801,
-  -0.8314696123025455,
-  -0.8280450452577557,
-  -0.8245893027850253,
-  -0.8211025149911049,
-  -0.8175848131515839,
-  -0.8140363297059483,
-  -0.8104571982525949,
-  -0.8068475535437994,
-  -0.8032075314806453,
-  -0.799537269107905,
-  -0.7958369046088837,
-  -0.7921065773002126,
-  -0.7883464276266061,
-  -0.7845565971555752,
-  -0.7807372285720947,
-  -0.7768884656732328,
-  -0.7730104533627369,
-  -0.7691033376455797,
-  -0.7651672656224592,
-  -0.7612023854842622,
-  -0.7572088465064846,
-  -0.7531867990436126,
-  -0.7491363945234597,
-  -0.7450577854414658,
-  -0.7409511253549591,
-  -0.73681656887737,
-  -0.7326542716724131,
-  -0.7284643904482251,
-  -0.724247082951467,
-  -0.7200025079613819,
-  -0.715730825283819,
-  -0.7114321957452164,
-  -0.7071067811865477,
-  -0.7027547444572256,
-  -0.6983762494089727,
-  -0.693971460889654,
-  -0.6895405447370672,
-  -0.6850836677727008,
-  -0.680600997795453,
-  -0.676092703575316,
-  -0.6715589548470187,
-  -0.666999922303638,
-  -0.6624157775901718,
-  -0.6578066932970789,
-  -0.6531728429537771,
-  -0.6485144010221123,
-  -0.6438315428897915,
-  -0.639124444863776,
-  -0.6343932841636459,
-  -0.629638238914927,
-  -0.6248594881423865,
-  -0.6200572117632894,
-  -0.6152315905806274,
-  -0.6103828062763095,
-  -0.6055110414043257,
-  -0.6006164793838693,
-  -0.5956993044924332,
-  -0.5907597018588743,
-  -0.5857978574564391,
-  -0.580813958095765,
-  -0.5758081914178452,
-  -0.5707807458869674,
-  -0.5657318107836136,
-  -0.5606615761973366,
-  -0.5555702330196022,
-  -0.550457972936605,
-  -0.5453249884220468,
-  -0.5401714727298927,
-  -0.5349976198870973,
-  -0.5298036246862949,
-  -0.5245896826784694,
-  -0.5193559901655895,
-  -0.5141027441932219,
-  -0.5088301425431074,
-  -0.5035383837257181,
-  -0.49822766697278187,
-  -0.49289819222978426,
-  -0.4875501601484364,
-  -0.4821837720791226,
-  -0.4767992300633222,
-  -0.4713967368259979,
-  -0.4659764957679667,
-  -0.46053871095823995,
-  -0.455083587126344,
-  -0.449611329654607,
-  -0.4441221445704298,
-  -0.43861623853852766,
-  -0.43309381885315223,
-  -0.42755509343028253,
-  -0.42200027079979957,
-  -0.41642956009763726,
-  -0.41084317105790424,
-  -0.4052413140049904,
-  -0.3996241998456468,
-  -0.39399204006104827,
-  -0.3883450466988267,
-  -0.3826834323650904,
-  -0.37700741021641826,
-  -0.3713171939518378,
-  -0.36561299780477435,
-  -0.359895036534988,
-  -0.3541635254204905,
-  -0.3484186802494349,
-  -0.34266071731199493,
-  -0.33688985339222,
-  -0.3311063057598766,
-  -0.32531029216226337,
-  -0.31950203081601547,
-  -0.3136817403988915,
-  -0.30784964004153514,
-  -0.3020059493192286,
-  -0.29615088824362373,
-  -0.2902846772544625,
-  -0.2844075372112722,
-  -0.27851968938505367,
-  -0.2726213554499489,
-  -0.2667127574748986,
-  -0.26079411791527596,
-  -0.2548656596045144,
-  -0.2489276057457202,
-  -0.24298017990326418,
-  -0.23702360599436773,
-  -0.231058108280671,
-  -0.22508391135979297,
-  -0.21910124015687016,
-  -0.21311031991609197,
-  -0.20711137619221853,
-  -0.20110463484209212,
-  -0.19509032201612872,
-  -0.18906866414980603,
-  -0.183039887955141,
-  -0.17700422041214905,
-  -0.17096188876030177,
-  -0.1649131204899698,
-  -0.15885814333386158,
-  -0.1527971852584438,
-  -0.1467304744553624,
-  -0.1406582393328492,
-  -0.13458070850712642,
-  -0.12849811079379364,
-  -0.12241067519921603,
-  -0.11631863091190484,
-  -0.11022220729388336,
-  -0.10412163387205513,
-  -0.0980171403295605,
-  -0.09190895649713288,
-  -0.08579731234444028,
-  -0.07968243797143075,
-  -0.07356456359966741,
-  -0.06744391956366429,
-  -0.06132073630220906,
-  -0.055195244349689775,
-  -0.04906767432741809,
-  -0.04293825693494114,
-  -0.036807222941359394,
-  -0.030674803176636543,
-  -0.024541228522912448,
-  -0.018406729905805226,
-  -0.012271538285720572,
-  -0.006135884649154477,
-};
\ No newline at end of file
+// Concatenate Rotate: Matrix, Precalc Table, Z (Matrix = Matrix * Rotate)
+void matrix_rotate_z( float matrix[], const int16_t precalc[], uint16_t z )
+{
+  float rotate[12];
+  matrix_identity(rotate);
+  rotate_z(rotate, precalc, z);
+  matrix_multiply(matrix, matrix, rotate);
+}
+
+// Concatenate Rotate: Matrix, Precalc Table, X, Y (Matrix = Matrix * Rotate, Same Order As rotate_xy)
+void matrix_rotate_xy( float matrix[], const int16_t precalc[], uint16_t x, uint16_t y )
+{
+  float rotate[12];
+  matrix_identity(rotate);
+  rotate_xy(rotate, precalc, x, y);
+  matrix_multiply(matrix, matrix, rotate);
+}
+
+// Concatenate Rotate: Matrix, Precalc Table, X, Z (Matrix = Matrix * Rotate, Same Order As rotate_xz)
+void matrix_rotate_xz( float matrix[], const int16_t precalc[], uint16_t x, uint16_t z )
+{
+  float rotate[12];
+  matrix_identity(rotate);
+  rotate_xz(rotate, precalc, x, z);
+  matrix_multiply(matrix, matrix, rotate);
+}
+
+// Concatenate Rotate: Matrix, Precalc Table, Y, Z (Matrix = Matrix * Rotate, Same Order As rotate_yz)
+void matrix_rotate_yz( float matrix[], const int16_t precalc[], uint16_t y, uint16_t z )
+{
+  float rotate[12];
+  matrix_identity(rotate);
+  rotate_yz(rotate, precalc, y, z);
+  matrix_multiply(matrix, matrix, rotate);
+}
+
+// Concatenate Rotate: Matrix, Precalc Table, X, Y, Z (Matrix = Matrix * Rotate, Same Order As rotate_xyz)
+void matrix_rotate_xyz( float matrix[], const int16_t precalc[], uint16_t x, uint16_t y, uint16_t z )
+{
+  float rotate[12];
+  matrix_identity(rotate);
+  rotate_xyz(rotate, precalc, x, y, z);
+  matrix_multiply(matrix, matrix, rotate);
+}
+
+// Sort Instances Back To Front By The Eye Z Of Their Positions (Painter's Order When Not Z-Buffered)
+// Insertion Sort: The Order Barely Changes Between Frames, So A Sorted Array Costs One Compare Per Instance
+void sort_instances( Instance3D inst[], uint16_t count )
+{
+  for(uint16_t n = 1; n < count; n++) {
+    Instance3D key = inst[n];
+    float z = (Matrix3D[8] * key.pos[0]) + (Matrix3D[9] * key.pos[1]) + (Matrix3D[10] * key.pos[2]);
+    uint16_t m = n;
+    for(; m > 0; m--) {
+      Instance3D *prev = &inst[m - 1];
+      if ((Matrix3D[8] * prev->pos[0]) + (Matrix3D[9] * prev->pos[1]) + (Matrix3D[10] * prev->pos[2]) >= z) break; // Farther Or Equal: Keep Order
+      inst[m] = *prev;
+    }
+    inst[m] = key;
+  }
+}
+
+// Fill Instances: Mesh, Instance Array, Instance Count, Culling, Precalc Table, Fill Function (fill_mesh, fill_zbuffer_mesh...)
+// Each Instance Concatenates Onto Matrix3D, Which Is Restored On Return
+void fill_instances( Mesh3D *mesh, Instance3D inst[], uint16_t count, uint8_t cull, const int16_t precalc[], void (*fill)( Mesh3D *mesh, uint8_t cull ) )
+{
+  // Per Mesh Setup: Keep The Parent Matrix & One Mesh Copy (Instances Only Swap Its Colors)
+  float parent[12], local[12];
+  for(int i = 0; i < 12; i++) parent[i] = Matrix3D[i];
+  Mesh3D copy = *mesh;
+
+  for(uint16_t n = 0; n < count; n++) {
+    Instance3D *in = &inst[n];
+
+    // Local Matrix = Translate * Rotate: Rotation Into An Identity, Translation Into Its Last Column
+    matrix_identity(local);
+    switch (in->axes) {
+      case ROTATE_X: rotate_x(local, precalc, in->rot[0]); break;
+      case ROTATE_Y: rotate_y(local, precalc, in->rot[1]); break;
+      case ROTATE_Z: rotate_z(local, precalc, in->rot[2]); break;
+      case ROTATE_X | ROTATE_Y: rotate_xy(local, precalc, in->rot[0], in->rot[1]); break;
+      case ROTATE_X | ROTATE_Z: rotate_xz(local, precalc, in->rot[0], in->rot[2]); break;
+      case ROTATE_Y | ROTATE_Z: rotate_yz(local, precalc, in->rot[1], in->rot[2]); break;
+      case ROTATE_X | ROTATE_Y | ROTATE_Z: rotate_xyz(local, precalc, in->rot[0], in->rot[1], in->rot[2]); break;
+    }
+    translate_xyz(local, in->pos[0], in->pos[1], in->pos[2]);
+    matrix_multiply(Matrix3D, parent, local); // One Multiply Per Instance
+
+    copy.col = (in->col != NULL) ? in->col : mesh->col;
+    fill(&copy, cull);
+  }
+
+  for(int i = 0; i < 12; i++) Matrix3D[i] = parent[i]; // Restore The Parent Matrix
+}
+
+static const int16_t Sin256[257] = { // 256 Rotations Per Quarter Turn (Sin, Q1.14, 0..90 Degrees Inclusive)
+  0,
+  101,
+  201,
+  302,
+  402,
+  503,
+  603,
+  704,
+  804,
+  904,
+  1005,
+  1105,
+  1205,
+  1306,
+  1406,
+  1506,
+  1606,
+  1706,
+  1806,
+  1906,
+  2006,
+  2105,
+  2205,
+  2305,
+  2404,
+  2503,
+  2603,
+  2702,
+  2801,
+  2900,
+  2999,
+  3098,
+  3196,
+  3295,
+  3393,
+  3492,
+  3590,
+  3688,
+  3786,
+  3883,
+  3981,
+  4078,
+  4176,
+  4273,
+  4370,
+  4467,
+  4563,
+  4660,
+  4756,
+  4852,
+  4948,
+  5044,
+  5139,
+  5235,
+  5330,
+  5425,
+  5520,
+  5614,
+  5708,
+  5803,
+  5897,
+  5990,
+  6084,
+  6177,
+  6270,
+  6363,
+  6455,
+  6547,
+  6639,
+  6731,
+  6823,
+  6914,
+  7005,
+  7096,
+  7186,
+  7276,
+  7366,
+  7456,
+  7545,
+  7635,
+  7723,
+  7812,
+  7900,
+  7988,
+  8076,
+  8163,
+  8250,
+  8337,
+  8423,
+  8509,
+  8595,
+  8680,
+  8765,
+  8850,
+  8935,
+  9019,
+  9102,
+  9186,
+  9269,
+  9352,
+  9434,
+  9516,
+  9598,
+  9679,
+  9760,
+  9841,
+  9921,
+  10001,
+  10080,
+  10159,
+  10238,
+  10316,
+  10394,
+  10471,
+  10549,
+  10625,
+  10702,
+  10778,
+  10853,
+  10928,
+  11003,
+  11077,
+  11151,
+  11224,
+  11297,
+  11370,
+  11442,
+  11514,
+  11585,
+  11656,
+  11727,
+  11797,
+  11866,
+  11935,
+  12004,
+  12072,
+  12140,
+  12207,
+  12274,
+  12340,
+  12406,
+  12472,
+  12537,
+  12601,
+  12665,
+  12729,
+  12792,
+  12854,
+  12916,
+  12978,
+  13039,
+  13100,
+  13160,
+  13219,
+  13279,
+  13337,
+  13395,
+  13453,
+  13510,
+  13567,
+  13623,
+  13678,
+  13733,
+  13788,
+  13842,
+  13896,
+  13949,
+  14001,
+  14053,
+  14104,
+  14155,
+  14206,
+  14256,
+  14305,
+  14354,
+  14402,
+  14449,
+  14497,
+  14543,
+  14589,
+  14635,
+  14680,
+  14724,
+  14768,
+  14811,
+  14854,
+  14896,
+  14937,
+  14978,
+  15019,
+  15059,
+  15098,
+  15137,
+  15175,
+  15213,
+  15250,
+  15286,
+  15322,
+  15357,
+  15392,
+  15426,
+  15460,
+  15493,
+  15525,
+  15557,
+  15588,
+  15619,
+  15649,
+  15679,
+  15707,
+  15736,
+  15763,
+  15791,
+  15817,
+  15843,
+  15868,
+  15893,
+  15917,
+  15941,
+  15964,
+  15986,
+  16008,
+  16029,
+  16049,
+  16069,
+  16088,
+  16107,
+  16125,
+  16143,
+  16160,
+  16176,
+  16192,
+  16207,
+  16221,
+  16235,
+  16248,
+  16261,
+  16273,
+  16284,
+  16295,
+  16305,
+  16315,
+  16324,
+  16332,
+  16340,
+  16347,
+  16353,
+  16359,
+  16364,
+  16369,
+  16373,
+  16376,
+  16379,
+  16381,
+  16383,
+  16384,
+  16384,
+};
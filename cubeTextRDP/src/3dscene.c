@@ -1,52 +1,76 @@
-// Object Triangle Vertices: X, Y, Z (Clockwise Winding)
-static float CubeTri[108] = {
-  // Cube Front Face
-  -10.0,  10.0, -10.0, // Triangle 1 Top Left
-   10.0,  10.0, -10.0, // Triangle 1 Top Right
-  -10.0, -10.0, -10.0, // Triangle 1 Bottom Left
-   10.0,  10.0, -10.0, // Triangle 2 Top Right
-   10.0, -10.0, -10.0, // Triangle 2 Bottom Right
-  -10.0, -10.0, -10.0, // Triangle 2 Bottom Left
+// Object Vertices: X, Y, Z (The 8 Unique Cube Corners, Shared Through CubeIndex)
+static float CubeVert[24] = {
+  -10.0,  10.0, -10.0, // Vertex 0 Front Top Left
+   10.0,  10.0, -10.0, // Vertex 1 Front Top Right
+  -10.0, -10.0, -10.0, // Vertex 2 Front Bottom Left
+   10.0, -10.0, -10.0, // Vertex 3 Front Bottom Right
+   10.0,  10.0,  10.0, // Vertex 4 Back Top Right
+  -10.0,  10.0,  10.0, // Vertex 5 Back Top Left
+   10.0, -10.0,  10.0, // Vertex 6 Back Bottom Right
+  -10.0, -10.0,  10.0, // Vertex 7 Back Bottom Left
+};
 
-  // Cube Back Face
-   10.0,  10.0,  10.0, // Triangle 3 Top Right
-  -10.0,  10.0,  10.0, // Triangle 3 Top Left
-   10.0, -10.0,  10.0, // Triangle 3 Bottom Right
-  -10.0,  10.0,  10.0, // Triangle 4 Top Left
-  -10.0, -10.0,  10.0, // Triangle 4 Bottom Left
-   10.0, -10.0,  10.0, // Triangle 4 Bottom Right
+// Object Vertices: X, Y, Z (Integer Copy Of CubeVert For FIXED_3D)
+static int16_t CubeVert16[24] = {
+  -10,  10, -10, // Vertex 0 Front Top Left
+   10,  10, -10, // Vertex 1 Front Top Right
+  -10, -10, -10, // Vertex 2 Front Bottom Left
+   10, -10, -10, // Vertex 3 Front Bottom Right
+   10,  10,  10, // Vertex 4 Back Top Right
+  -10,  10,  10, // Vertex 5 Back Top Left
+   10, -10,  10, // Vertex 6 Back Bottom Right
+  -10, -10,  10, // Vertex 7 Back Bottom Left
+};
 
-  // Cube Left Face
-  -10.0,  10.0,  10.0, // Triangle 5 Top Left
-  -10.0,  10.0, -10.0, // Triangle 5 Top Right
-  -10.0, -10.0,  10.0, // Triangle 5 Bottom Left
-  -10.0,  10.0, -10.0, // Triangle 6 Top Right
-  -10.0, -10.0, -10.0, // Triangle 6 Bottom Right
-  -10.0, -10.0,  10.0, // Triangle 6 Bottom Left
+// Object Triangle Indices: Vertex 1, 2, 3 (Clockwise Winding, 2 Triangles Per Face)
+static uint16_t CubeIndex[36] = {
+  0, 1, 2,  1, 3, 2, // Cube Front Face: Triangle 1, 2
+  4, 5, 6,  5, 7, 6, // Cube Back Face: Triangle 3, 4
+  5, 0, 7,  0, 2, 7, // Cube Left Face: Triangle 5, 6
+  1, 4, 3,  4, 6, 3, // Cube Right Face: Triangle 7, 8
+  1, 0, 5,  1, 5, 4, // Cube Top Face: Triangle 9, 10
+  2, 3, 6,  2, 6, 7, // Cube Bottom Face: Triangle 11, 12
+};
 
-  // Cube Right Face
-   10.0,  10.0, -10.0, // Triangle 7 Top Left
-   10.0,  10.0,  10.0, // Triangle 7 Top Right
-   10.0, -10.0, -10.0, // Triangle 7 Bottom Left
-   10.0,  10.0,  10.0, // Triangle 8 Top Right
-   10.0, -10.0,  10.0, // Triangle 8 Bottom Right
-   10.0, -10.0, -10.0, // Triangle 8 Bottom Left
+// Object Vertex Colors: R, G, B, A (Per CubeVert Corner: Red Along +X, Green Along +Y, Blue Along +Z)
+static uint8_t CubeVertCol[32] = {
+    0,255,  0,255, // Vertex 0 Front Top Left
+  255,255,  0,255, // Vertex 1 Front Top Right
+    0,  0,  0,255, // Vertex 2 Front Bottom Left
+  255,  0,  0,255, // Vertex 3 Front Bottom Right
+  255,255,255,255, // Vertex 4 Back Top Right
+    0,255,255,255, // Vertex 5 Back Top Left
+  255,  0,255,255, // Vertex 6 Back Bottom Right
+    0,  0,255,255, // Vertex 7 Back Bottom Left
+};
 
-  // Cube Top Face
-   10.0,  10.0, -10.0, // Triangle 9 Top Right
-  -10.0,  10.0, -10.0, // Triangle 9 Top Left
-  -10.0,  10.0,  10.0, // Triangle 9 Bottom Left
-   10.0,  10.0, -10.0, // Triangle 10 Top Right
-  -10.0,  10.0,  10.0, // Triangle 10 Bottom Left
-   10.0,  10.0,  10.0, // Triangle 10 Bottom Right
-
-  // Bottom Face
-  -10.0, -10.0, -10.0, // Triangle 11 Top Left
-   10.0, -10.0, -10.0, // Triangle 11 Top Right
-   10.0, -10.0,  10.0, // Triangle 11 Bottom Right
-  -10.0, -10.0, -10.0, // Triangle 12 Top Left
-   10.0, -10.0,  10.0, // Triangle 12 Bottom Right
-  -10.0, -10.0,  10.0, // Triangle 12 Bottom Left
+// Object Texture Coordinates: S, T Per Triangle Corner In Texels (Same Corner Order As CubeIndex, Whole 64x64 Texture Per Face)
+static float CubeUV[72] = {
+   0.0,  0.0, 64.0,  0.0,  0.0, 64.0,  64.0,  0.0, 64.0, 64.0,  0.0, 64.0, // Cube Front Face: Triangle 1, 2
+  64.0,  0.0,  0.0,  0.0, 64.0, 64.0,   0.0,  0.0,  0.0, 64.0, 64.0, 64.0, // Cube Back Face: Triangle 3, 4
+   0.0,  0.0, 64.0,  0.0,  0.0, 64.0,  64.0,  0.0, 64.0, 64.0,  0.0, 64.0, // Cube Left Face: Triangle 5, 6
+   0.0,  0.0, 64.0,  0.0,  0.0, 64.0,  64.0,  0.0, 64.0, 64.0,  0.0, 64.0, // Cube Right Face: Triangle 7, 8
+  64.0,  0.0,  0.0,  0.0,  0.0, 64.0,  64.0,  0.0,  0.0, 64.0, 64.0, 64.0, // Cube Top Face: Triangle 9, 10
+   0.0,  0.0, 64.0,  0.0, 64.0, 64.0,   0.0,  0.0, 64.0, 64.0,  0.0, 64.0, // Cube Bottom Face: Triangle 11, 12
+};
+
+// Object Bounding Volume: Sphere Centre, Radius, Box Minimum, Box Maximum
+static Bound3D CubeBound = { { 0.0, 0.0, 0.0 }, 17.320509, { -10.0, -10.0, -10.0 }, { 10.0, 10.0, 10.0 } };
+
+// Object Face Planes: Normal X, Y, Z, D (Outward Unit Normal Of Each CubeIndex Triangle, D = Normal . First Vertex)
+static float CubeNormal[48] = {
+   0.0,  0.0, -1.0, 10.0, // Cube Front Face: Triangle 1
+   0.0,  0.0, -1.0, 10.0, // Triangle 2
+   0.0,  0.0,  1.0, 10.0, // Cube Back Face: Triangle 3
+   0.0,  0.0,  1.0, 10.0, // Triangle 4
+  -1.0,  0.0,  0.0, 10.0, // Cube Left Face: Triangle 5
+  -1.0,  0.0,  0.0, 10.0, // Triangle 6
+   1.0,  0.0,  0.0, 10.0, // Cube Right Face: Triangle 7
+   1.0,  0.0,  0.0, 10.0, // Triangle 8
+   0.0,  1.0,  0.0, 10.0, // Cube Top Face: Triangle 9
+   0.0,  1.0,  0.0, 10.0, // Triangle 10
+   0.0, -1.0,  0.0, 10.0, // Cube Bottom Face: Triangle 11
+   0.0, -1.0,  0.0, 10.0, // Triangle 12
 };
 
 // Object Triangle Colors: R, G, B, A
@@ -211,10 +235,16 @@ static uint8_t CubeCyanCol[48] = {
   0,100,100,255, // Triangle 12 Color
 };
 
-// Scene Object Position Data: Translation X, Y, Z
-static float CubeRedPos[3] = { -35.0, 20.0, 90.0 }; // Object Position: X, Y, Z
-static float CubeGreenPos[3] = { 0.0, 20.0, 90.0 }; // Object Position: X, Y, Z
-static float CubeBluePos[3] = { 35.0, 20.0, 90.0 }; // Object Position: X, Y, Z
-static float CubeYellowPos[3] = {-35.0, -20.0, 90.0 }; // Object Position: X, Y, Z
-static float CubePurplePos[3] = { 0.0, -20.0, 90.0 }; // Object Position: X, Y, Z
-static float CubeCyanPos[3] = { 35.0, -20.0, 90.0 }; // Object Position: X, Y, Z
+// Scene Object Mesh: Vert Array, Integer Vert Array, Index Array, Color Array, Vertex Color Array, Texture Coordinate Array, Face Plane Array, Bounding Volume, Vertex Count, Triangle Count
+static Mesh3D CubeMesh = { CubeVert, CubeVert16, CubeIndex, CubeRedCol, CubeVertCol, CubeUV, CubeNormal, &CubeBound, 8, 12 };
+
+// Scene Object Instances: Position X, Y, Z, Rotation X, Y, Z (Updated Per Frame), Rotation Axes, Color Array
+#define CUBE_INSTANCES 6
+static Instance3D CubeInstance[CUBE_INSTANCES] = {
+  { { -35.0,  20.0, 90.0 }, { 0, 0, 0 }, ROTATE_X, CubeRedCol },
+  { {   0.0,  20.0, 90.0 }, { 0, 0, 0 }, ROTATE_Y, CubeGreenCol },
+  { {  35.0,  20.0, 90.0 }, { 0, 0, 0 }, ROTATE_Z, CubeBlueCol },
+  { { -35.0, -20.0, 90.0 }, { 0, 0, 0 }, ROTATE_X | ROTATE_Y, CubeYellowCol },
+  { {   0.0, -20.0, 90.0 }, { 0, 0, 0 }, ROTATE_X | ROTATE_Z, CubePurpleCol },
+  { {  35.0, -20.0, 90.0 }, { 0, 0, 0 }, ROTATE_X | ROTATE_Y | ROTATE_Z, CubeCyanCol },
+};
@@ -9,6 +9,7 @@
 //
 
 #include <rcp/vi.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <syscall.h>
 #include "rdp.c"
@@ -16,6 +17,11 @@
 #include "3dscene.c"
 
 #define IS_TEXTURED 1
+#define IS_PERSPECTIVE 1 // 1 = Perspective Correct Texturing (PERSP_TEX_EN & W Gradients From 1/W), 0 = Affine
+#define IS_ZBUFFER 1 // 1 = Depth Buffered (Overlapping Cubes Resolve Per Pixel), 0 = Painter's Order (Cubes Sorted Back To Front Each Frame)
+
+#define ZBUFFER_ORIGIN 0x00180000 // Z Image DRAM Address (320x240x16B): Past The RDP List, In Another 1MB Bank Than Both Frame Buffers
+#define ZBUFFER_CLEAR 0xFFFCFFFC // Z Image Clear Fill Word: Two 16-Bit Z Pixels At The Far Depth (DZ 0)
 
 
 // These pre-defined values are suitable for NTSC.
@@ -117,56 +123,31 @@ static uint16_t Tlut[48] = {
 #endif
 
 
-// Draw Fill Triangle (From 3 Unsorted X/Y Points, With Fill Color)
-void rdp_draw_txt_triangle( float x1, float y1, float x2, float y2, float x3, float y3 )
+// Draw Texture Triangle (From 3 Unsorted X/Y Points With S/T Texel Coordinates & 1/W, Flat Filled When IS_TEXTURED Is 0, Depth From 1/W When IS_ZBUFFER Is 1)
+void rdp_draw_txt_triangle( float x1, float y1, float s1, float t1, float inv_w1, float x2, float y2, float s2, float t2, float inv_w2, float x3, float y3, float s3, float t3, float inv_w3 )
 {
-    float temp_x, temp_y;
-
-    // Sort Vertices By Y Ascending To Find The Major, Mid & Low Edges
-    if( y1 > y2 ) { temp_x = x2, temp_y = y2; y2 = y1; y1 = temp_y; x2 = x1; x1 = temp_x; }
-    if( y2 > y3 ) { temp_x = x3, temp_y = y3; y3 = y2; y2 = temp_y; x3 = x2; x2 = temp_x; }
-    if( y1 > y2 ) { temp_x = x2, temp_y = y2; y2 = y1; y1 = temp_y; x2 = x1; x1 = temp_x; }
-
-    // yh = y1, ym = y2, yl = y3
-    // xh = x1, xm = x1, xl = x2
-    // Calculate Inverse Slopes
-    float dxhdy = ( y3 == y1 ) ? 0 : ( ( x3 - x1 ) / ( y3 - y1 ) );
-    float dxmdy = ( y2 == y1 ) ? 0 : ( ( x2 - x1 ) / ( y2 - y1 ) );
-    float dxldy = ( y3 == y2 ) ? 0 : ( ( x3 - x2 ) / ( y3 - y2 ) );
-
-    // Determine Triangle Winding Left Major Flag
-    int Hdx = x3 - x1; int Hdy = y3 - y1;
-    int Mdx = x2 - x1; int Mdy = y2 - y1;
-    int r = Hdx * Mdy - Hdy * Mdx;
-    int lft = r < 0 ? 1 : 0;
-
-// Command & Edge Coefficients
-
- #if IS_TEXTURED
-    
-           
-// Texture Triangle (Textured Non-Shaded) Edge Coefficients
-//void rdp_texture_triangle( uint8_t lft, uint8_t level, uint8_t tile, float yl, float ym, float yh, float xl, float dxldy, float xh, float dxhdy, float xm, float dxmdy )
-
-
-	rdp_texture_triangle( lft, 0, 0, y3, y2, y1, x2, dxldy, x1, dxhdy, x1, dxmdy ); // lft, Level, Tile, YL, YM, YH, XL,DxLDy, XH,DxHDy, XM, DxMDy
-	// rdp_texture_rectangle(x1,dxhdy, x2,dxmdy, 0.0,0.0, 1.0,1.0, 0); // Texture Rectangle: XH,YH, XL,YL, S,T, DSDX,DTDY, Tile
-
-	
-   #else
-     
-// Fill Triangle (Flat Non-Shaded) Edge Coefficients
-//void rdp_fill_triangle( uint8_t lft, uint8_t level, uint8_t tile, float yl, float ym, float yh, float xl, float dxldy, float xh, float dxhdy, float xm, float dxmdy )
-
-        rdp_fill_triangle( lft, 0, 0, y3, y2, y1, x2, dxldy, x1, dxhdy, x1, dxmdy ); // lft, Level, Tile, YL, YM, YH, XL,DxLDy, XH,DxHDy, XM, DxMDy
-  #endif
+#if IS_TEXTURED && IS_PERSPECTIVE && IS_ZBUFFER
+  rdp_draw_texture_zbuffer_triangle_persp( x1,y1,depth_3d(inv_w1),s1,t1,inv_w1, x2,y2,depth_3d(inv_w2),s2,t2,inv_w2, x3,y3,depth_3d(inv_w3),s3,t3,inv_w3 ); // X,Y,Z,S,T,1/W Per Point
+#elif IS_TEXTURED && IS_PERSPECTIVE
+  rdp_draw_texture_triangle_persp( x1,y1,s1,t1,inv_w1, x2,y2,s2,t2,inv_w2, x3,y3,s3,t3,inv_w3 ); // X,Y,S,T,1/W Per Point
+#elif IS_TEXTURED && IS_ZBUFFER
+  rdp_draw_texture_zbuffer_triangle( x1,y1,depth_3d(inv_w1),s1,t1,0.0, x2,y2,depth_3d(inv_w2),s2,t2,0.0, x3,y3,depth_3d(inv_w3),s3,t3,0.0 ); // X,Y,Z,S,T,W Per Point (Affine: W Unused)
+#elif IS_TEXTURED
+  (void)inv_w1; (void)inv_w2; (void)inv_w3;
+  rdp_draw_texture_triangle( x1,y1,s1,t1,0.0, x2,y2,s2,t2,0.0, x3,y3,s3,t3,0.0 ); // X,Y,S,T,W Per Point (Affine: W Unused)
+#elif IS_ZBUFFER
+  (void)s1; (void)t1; (void)s2; (void)t2; (void)s3; (void)t3;
+  rdp_draw_fill_zbuffer_triangle( x1,y1,depth_3d(inv_w1), x2,y2,depth_3d(inv_w2), x3,y3,depth_3d(inv_w3) ); // X1,Y1,Z1, X2,Y2,Z2, X3,Y3,Z3
+#else
+  (void)s1; (void)t1; (void)inv_w1; (void)s2; (void)t2; (void)inv_w2; (void)s3; (void)t3; (void)inv_w3;
+  rdp_draw_fill_triangle( x1,y1, x2,y2, x3,y3 ); // X1,Y1, X2,Y2, X3,Y3
+#endif
 }
- 
 
-// fill_text_triangle_array: Vert Array, Color Array, Culling, Base, Length
-void fill_text_triangle_array( float vert[], uint8_t col[], uint8_t cull, uint32_t base, uint32_t length)
+// fill_text_triangle_array: Vert Array, Texture Coordinate Array (S,T Per Corner), Color Array, Culling, Base, Length
+void fill_text_triangle_array( float vert[], float uv[], uint8_t col[], uint8_t cull, uint32_t base, uint32_t length)
 {
-  for(uint32_t v = base, c = (base / 9) << 2; v < (base + length); v += 9, c += 4) {
+  for(uint32_t v = base, u = (base / 9) * 6, c = (base / 9) << 2; v < (base + length); v += 9, u += 6, c += 4) {
     // Calculate 3D Points
     XYZResult xyz1 = calc_3d(Matrix3D, vert[v], vert[v + 1], vert[v + 2]);
     XYZResult xyz2 = calc_3d(Matrix3D, vert[v + 3], vert[v + 4], vert[v + 5]);
@@ -177,66 +158,100 @@ void fill_text_triangle_array( float vert[], uint8_t col[], uint8_t cull, uint32
     XYResult xy2 = calc_2d(xyz2.x, xyz2.y, xyz2.z);
     XYResult xy3 = calc_2d(xyz3.x, xyz3.y, xyz3.z);
 
+    // Trivially Reject Off Screen Triangles, Clip Triangles Crossing The Near Plane (Or Leaving The Guard Band) & Draw The Result As A Fan
+    uint8_t test = clip_test(clip_code(xyz1.z, xy1), clip_code(xyz2.z, xy2), clip_code(xyz3.z, xy3));
+    if (test == TRI_REJECT) continue;
+    if (test == TRI_CLIP) {
+      ClipPoint3D poly[CLIP_MAX_VERTS];
+      uint8_t count = clip_triangle(xyz1, xyz2, xyz3, &uv[u], NULL, cull, poly);
+      if (count) rdp_set_blend_color(col[c], col[c + 1], col[c + 2], col[c + 3]); // Set Blend Color: R,G,B,A
+      for(uint8_t k = 2; k < count; k++) rdp_draw_txt_triangle( poly[0].x,poly[0].y,poly[0].s,poly[0].t,poly[0].inv_w, poly[k - 1].x,poly[k - 1].y,poly[k - 1].s,poly[k - 1].t,poly[k - 1].inv_w, poly[k].x,poly[k].y,poly[k].s,poly[k].t,poly[k].inv_w ); // Draw Fan Triangle: X1,Y1,S1,T1,1/W1 X2,Y2,S2,T2,1/W2 X3,Y3,S3,T3,1/W3
+      continue;
+    }
+
     // Test Polygon Winding Direction (IF Triangle Winding > 0.0: Clockwise ELSE: Anti-Clockwise)
     int winding = poly_winding(xy1.x,xy1.y, xy2.x,xy2.y, xy3.x,xy3.y);
 
     if((cull == CULL_NONE) || ((winding <= 0) && (cull == CULL_BACK)) || ((winding > 0) && (cull == CULL_FRONT))) {
       rdp_set_blend_color(col[c], col[c + 1], col[c + 2], col[c + 3]); // Set Blend Color: R,G,B,A
-    
-      rdp_draw_txt_triangle( xy1.x,xy1.y, xy2.x,xy2.y, xy3.x,xy3.y ); // Draw Fill Triangle: X1,Y1, X2,Y2, X3,Y3
-   
-
-
-      rdp_sync_pipe(); // Stall Pipeline, Until Preceeding Primitives Completely Finish
+      rdp_draw_txt_triangle( xy1.x,xy1.y,uv[u],uv[u + 1],1.0 / xyz1.z, xy2.x,xy2.y,uv[u + 2],uv[u + 3],1.0 / xyz2.z, xy3.x,xy3.y,uv[u + 4],uv[u + 5],1.0 / xyz3.z ); // Draw Texture Triangle: X1,Y1,S1,T1,1/W1 X2,Y2,S2,T2,1/W2 X3,Y3,S3,T3,1/W3
     }
   }
 }
 
 
+// fill_text_mesh: Mesh (With Texture Coordinates), Culling (Each Unique Vertex Transformed Once)
+void fill_text_mesh( Mesh3D *mesh, uint8_t cull )
+{
+  if (!cull_mesh(mesh, cull)) return; // Every Face Culled (Or Mesh Too Large)
+  transform_mesh(mesh);
+
+  for(uint32_t t = 0, i = 0, c = 0; t < mesh->tri_count; t++, i += 3, c += 4) {
+    if (!MeshFaceVisible[t]) continue; // Culled In Object Space
+
+    // Trivially Reject Off Screen Faces, Clip Faces Crossing The Near Plane (Or Leaving The Guard Band) & Draw The Result As A Fan
+    uint8_t test = clip_test(MeshClip[mesh->index[i]], MeshClip[mesh->index[i + 1]], MeshClip[mesh->index[i + 2]]);
+    if (test == TRI_REJECT) continue;
+    if (test == TRI_CLIP) {
+      ClipPoint3D poly[CLIP_MAX_VERTS];
+      uint8_t count = clip_mesh_face(mesh, i, cull, poly);
+      if (count) rdp_set_blend_color(mesh->col[c], mesh->col[c + 1], mesh->col[c + 2], mesh->col[c + 3]); // Set Blend Color: R,G,B,A
+      for(uint8_t k = 2; k < count; k++) rdp_draw_txt_triangle( poly[0].x,poly[0].y,poly[0].s,poly[0].t,poly[0].inv_w, poly[k - 1].x,poly[k - 1].y,poly[k - 1].s,poly[k - 1].t,poly[k - 1].inv_w, poly[k].x,poly[k].y,poly[k].s,poly[k].t,poly[k].inv_w ); // Draw Fan Triangle: X1,Y1,S1,T1,1/W1 X2,Y2,S2,T2,1/W2 X3,Y3,S3,T3,1/W3
+      continue;
+    }
 
-void main(void *unused __attribute__((unused))) {
-  // Register VI interrupts on this thread. When registering a thread w/
-  // interrupts, it causes the threads message queue to get populated w/
-  // a message each time an interrupt fires.
-  libn64_thread_reg_intr(libn64_thread_self(), LIBN64_INTERRUPT_VI);
+    uint16_t i1 = mesh->index[i], i2 = mesh->index[i + 1], i3 = mesh->index[i + 2];
+    XYResult xy1 = MeshXY[i1], xy2 = MeshXY[i2], xy3 = MeshXY[i3];
+    float *uv = &mesh->uv[i * 2]; // S,T Per Corner
 
-  // Variables
-  uint16_t XRot = 0; // X Rotation Value (0..1023)
-  uint16_t YRot = 0; // Y Rotation Value (0..1023)
-  uint16_t ZRot = 0; // Z Rotation Value (0..1023)
+    // Test Polygon Winding Direction (IF Triangle Winding > 0.0: Clockwise ELSE: Anti-Clockwise)
+    int winding = (mesh->normal != NULL) ? 0 : poly_winding(xy1.x,xy1.y, xy2.x,xy2.y, xy3.x,xy3.y);
+
+    if((cull == CULL_NONE) || (mesh->normal != NULL) || ((winding <= 0) && (cull == CULL_BACK)) || ((winding > 0) && (cull == CULL_FRONT))) {
+      rdp_set_blend_color(mesh->col[c], mesh->col[c + 1], mesh->col[c + 2], mesh->col[c + 3]); // Set Blend Color: R,G,B,A
+      rdp_draw_txt_triangle( xy1.x,xy1.y,uv[0],uv[1],MeshInvW[i1], xy2.x,xy2.y,uv[2],uv[3],MeshInvW[i2], xy3.x,xy3.y,uv[4],uv[5],MeshInvW[i3] ); // Draw Texture Triangle: X1,Y1,S1,T1,1/W1 X2,Y2,S2,T2,1/W2 X3,Y3,S3,T3,1/W3
+    }
+  }
+}
+
+
+// Scene Prologue: Scissor, Frame Buffer Clear & Render State (Recorded Once Per Frame List)
+// Returns The Patch Point Of The Set Color Image Command
+uint32_t scene_prologue( void )
+{
+  uint32_t origin_mark;
 
-  // Setup RDP buffer
-  uint32_t rdp_start = memory_pos;
   rdp_set_scissor(0.0,0.0, 320.0,240.0, SCISSOR_FIELD_DISABLE,SCISSOR_EVEN); // Set Scissor: XH,YH, XL,YL, Scissor Field Enable,Field
   rdp_set_other_modes(CYCLE_TYPE_FILL); // Set_Other_Modes: CYCLE_TYPE_FILL
 
+#if IS_ZBUFFER
+  // Clear The Z Image Each Frame As A 16-Bit Color Image: FILL Mode Writes 4 Pixels Per Clock With No Z Read
+  rdp_set_z_image(ZBUFFER_ORIGIN); // Set Z Image: DRAM Address
+  rdp_set_color_image(IMAGE_DATA_FORMAT_RGBA,SIZE_OF_PIXEL_16B,320, ZBUFFER_ORIGIN); // Set Color Image: Format,Size, Width, DRAM Address (The Z Image)
+  rdp_set_fill_word(ZBUFFER_CLEAR); // Set Fill Color: Packed Word (Far Depth)
+  rdp_fill_rectangle(0.0,0.0, 319.0,239.0); // Fill Rectangle: XH,YH, XL,YL
+#endif
 
-// Setup RDP frame buffer
-  uint32_t rdp_fb_origin = memory_pos + 4;
-  
-  
 #if IS_TEXTURED
  // Variables
   float x = 48.0;
   float y = 8.0;
   
+  origin_mark = rdp_list_mark();
   rdp_set_color_image(IMAGE_DATA_FORMAT_RGBA,SIZE_OF_PIXEL_16B,320, 0x00000000); // Set Color Image: Format,Size, Width, DRAM Address
   rdp_set_fill_color(255,230,0,255); // Set Fill Color: R,G,B,A (Yellow)
   rdp_fill_rectangle(0.0,0.0, 319.0,239.0); // Fill Rectangle: XH,YH, XL,YL
-  rdp_sync_pipe(); // Stall Pipeline, Until Preceeding Primitives Completely Finish
 
-  rdp_set_other_modes(EN_TLUT|SAMPLE_TYPE|BI_LERP_0|ALPHA_DITHER_SEL_NO_DITHER|B_M2A_0_1|FORCE_BLEND|IMAGE_READ_EN); // Set Other Modes
+  rdp_set_other_modes((IS_PERSPECTIVE ? PERSP_TEX_EN : 0)|(IS_ZBUFFER ? Z_COMPARE_EN|Z_UPDATE_EN : 0)|EN_TLUT|SAMPLE_TYPE|BI_LERP_0|ALPHA_DITHER_SEL_NO_DITHER|B_M2A_0_1|FORCE_BLEND|IMAGE_READ_EN); // Set Other Modes (Perspective Correction Needs The W Gradients Of rdp_draw_texture_triangle_persp, Z Compare & Update Need The Z Image)
   rdp_set_combine_mode(0x0,0x00, 0,0, 0x6,0x01, 0x0,0xF, 1,0, 0,0,0, 7,7,7); // Set Combine Mode: SubA RGB0,MulRGB0, SubA Alpha0,MulAlpha0, SubA RGB1,MulRGB1, SubB RGB0,SubB RGB1, SubA Alpha1,MulAlpha1, AddRGB0,SubB Alpha0,AddAlpha0, AddRGB1,SubB Alpha1,AddAlpha1
 
   rdp_set_texture_image(IMAGE_DATA_FORMAT_RGBA,SIZE_OF_PIXEL_16B,1, (uint32_t)Tlut); // Set Texture Image: Format,Size,Width, DRAM Address
   rdp_set_tile(0,0,0, 0x100, 0,0, 0,0,0,0, 0,0,0,0); // Set Tile: TMEM Address, Tile
   rdp_load_tlut(0.0,0.0, 47.0,0.0, 0); // Load Tlut: SL,TL, SH,TH, Tile
 
-  rdp_sync_tile(); // Sync Tile
   rdp_set_texture_image(IMAGE_DATA_FORMAT_RGBA,SIZE_OF_PIXEL_16B,16, (uint32_t)Texture64x64); // Set Texture Image: Format,Size,Width, DRAM Address
   rdp_set_tile(IMAGE_DATA_FORMAT_RGBA,SIZE_OF_PIXEL_16B,4, 0x000, 0,0, 0,0,0,0, 0,0,0,0); // Set Tile: Format,Size,Tile Line Size (64bit Words), TMEM Address, Tile
   rdp_load_tile(0.0,0.0, 63.0,63.0, 0); // Load Tile: SL,TL, SH,TH, Tile
-  rdp_sync_tile(); // Sync Tile
   rdp_set_tile(IMAGE_DATA_FORMAT_COLOR_INDX,SIZE_OF_PIXEL_4B,4, 0x000, 0,PALETTE_2, 0,0,0,0, 0,0,0,0); // Set Tile: Format,Size,Tile Line Size (64bit Words), TMEM Address, Tile,Palette
  // uint32_t rdp_rectangle = memory_pos;
  // rdp_texture_rectangle(x,y, x+64.0,y+64.0, 0.0,0.0, 1.0,1.0, 0); // Texture Rectangle: XH,YH, XL,YL, S,T, DSDX,DTDY, Tile
@@ -244,17 +259,41 @@ void main(void *unused __attribute__((unused))) {
   
 #else
 
+  origin_mark = rdp_list_mark();
   rdp_set_color_image(IMAGE_DATA_FORMAT_RGBA,SIZE_OF_PIXEL_16B, 320, 0x00000000); // Set Color Image: Format,Size, Width, DRAM Address
   rdp_set_fill_color(24,128,212,255); // Set Fill Color: R,G,B,A (Blue)
   rdp_fill_rectangle(0.0,0.0, 319.0,239.0); // Fill Rectangle: XH,YH, XL,YL
-  rdp_sync_pipe(); // Stall Pipeline, Until Preceeding Primitives Completely Finish
 
-  rdp_set_other_modes(SAMPLE_TYPE|BI_LERP_0|ALPHA_DITHER_SEL_NO_DITHER|B_M1A_0_2); // Set Other Modes
+  rdp_set_other_modes((IS_ZBUFFER ? Z_COMPARE_EN|Z_UPDATE_EN : 0)|SAMPLE_TYPE|BI_LERP_0|ALPHA_DITHER_SEL_NO_DITHER|B_M1A_0_2); // Set Other Modes
   rdp_set_combine_mode(0x0,0x00, 0,0, 0x6,0x01, 0x0,0xF, 1,0, 0,0,0, 7,7,7); // Set Combine Mode: SubA RGB0,MulRGB0, SubA Alpha0,MulAlpha0, SubA RGB1,MulRGB1, SubB RGB0,SubB RGB1, SubA Alpha1,MulAlpha1, AddRGB0,SubB Alpha0,AddAlpha0, AddRGB1,SubB Alpha1,AddAlpha1
 #endif
 
+  return origin_mark;
+}
+
+void main(void *unused __attribute__((unused))) {
+  // Register VI interrupts on this thread. When registering a thread w/
+  // interrupts, it causes the threads message queue to get populated w/
+  // a message each time an interrupt fires.
+  libn64_thread_reg_intr(libn64_thread_self(), LIBN64_INTERRUPT_VI);
 
-  uint32_t rdp_buffer = memory_pos; // Set RDP Buffer Address
+  // Variables
+  uint16_t XRot = 0; // X Rotation Value (0..1023)
+  uint16_t YRot = 0; // Y Rotation Value (0..1023)
+  uint16_t ZRot = 0; // Z Rotation Value (0..1023)
+
+  // Setup RDP buffer: Double Buffered Frame Lists Over The Whole RDP DRAM List
+  rdp_frames_init(0);
+
+  // Record the prologue once at the start of each frame list
+  RDPList prologue[RDP_FRAMES];
+  uint32_t prologue_origin[RDP_FRAMES];
+  for (uint32_t i = 0; i < RDP_FRAMES; i++) {
+    rdp_frame_begin();
+    rdp_list_begin(&prologue[i]);
+    prologue_origin[i] = scene_prologue();
+    rdp_list_end(&prologue[i]);
+  }
 
   // For each frame...
   while (1) {
@@ -262,59 +301,41 @@ void main(void *unused __attribute__((unused))) {
     vi_flush_state(&vi_state);
     vi_state.origin ^= 0x100000; // 1MB
 
+    // Begin the next frame list (waits only if the RDP is still fetching it)
+    rdp_frame_begin();
+
     // RDP set color image to last fb, clear the framebuffer to fill color
-    *(uintptr_t *)(0xA0100000 | rdp_fb_origin) = vi_state.origin; // Set Color Image: DRAM ADDRESS vi_state.origin
+    rdp_patch_address(prologue_origin[rdp_frame], vi_state.origin); // Set Color Image: DRAM ADDRESS vi_state.origin
+    rdp_list_append(&prologue[rdp_frame]); // Draw after the recorded prologue
 
     // Draw scene
+    stats_3d_reset(); // Count Culled Objects, Culled Faces & Transformed Vertices Per Frame
+    matrix_identity(Matrix3D); // View Matrix (Camera At The Origin): Each Cube Concatenates Onto It
     // translate_x(Matrix3D, 50.0); // Translate: Matrix, X
     // translate_y(Matrix3D, 50.0); // Translate: Matrix, Y
     // translate_z(Matrix3D, 50.0); // Translate: Matrix, Z
     // translate_xyz(Matrix3D, CubeAPos[0], CubeAPos[1], CubeAPos[2]); // Translate: Matrix, X, Y, Z
-    // rotate_x(Matrix3D, SinCos1024, XRot); // Rotate: Matrix, Precalc Table, X
-    // rotate_y(Matrix3D, SinCos1024, YRot); // Rotate: Matrix, Precalc Table, Y
-    // rotate_z(Matrix3D, SinCos1024, ZRot); // Rotate: Matrix, Precalc Table, Z
-    // rotate_xy(Matrix3D, SinCos1024, XRot, YRot); // Rotate: Matrix, Precalc Table, X, Y
-    // rotate_xz(Matrix3D, SinCos1024, XRot, ZRot); // Rotate: Matrix, Precalc Table, X, Z
-    // rotate_yz(Matrix3D, SinCos1024, YRot, ZRot); // Rotate: Matrix, Precalc Table, Y, Z
-    // rotate_xyz(Matrix3D, SinCos1024, XRot, YRot, ZRot); // Rotate: Matrix, Precalc Table, X, Y, Z
-
-    memory_pos = rdp_buffer; // Set Start Of RDP Buffer
-
-    matrix_identity(Matrix3D); // Reset Matrix To Identity
-    translate_xyz(Matrix3D, CubeRedPos[0], CubeRedPos[1], CubeRedPos[2]); // Translate: Matrix, X, Y, Z
-    rotate_x(Matrix3D, Sin1024, XRot); // Rotate: Matrix, Precalc Table, X
-    fill_text_triangle_array(CubeTri, CubeRedCol, CULL_BACK, 0, 108); // Fill Triangle Array: Vert Array, Color Array, RDP Buffer, Culling, Base, Length
-
-
-
-    matrix_identity(Matrix3D); // Reset Matrix To Identity
-    translate_xyz(Matrix3D, CubeGreenPos[0], CubeGreenPos[1], CubeGreenPos[2]); // Translate: Matrix, X, Y, Z
-    rotate_y(Matrix3D, Sin1024, YRot); // Rotate: Matrix, Precalc Table, Y
-    fill_text_triangle_array(CubeTri, CubeGreenCol, CULL_BACK, 0, 108); // Fill Triangle Array: Vert Array, Color Array, RDP Buffer, Culling, Base, Length
-
-    matrix_identity(Matrix3D); // Reset Matrix To Identity
-    translate_xyz(Matrix3D, CubeBluePos[0], CubeBluePos[1], CubeBluePos[2]); // Translate: Matrix, X, Y, Z
-    rotate_z(Matrix3D, Sin1024, ZRot); // Rotate: Matrix, Precalc Table, Z
-    fill_text_triangle_array(CubeTri, CubeBlueCol, CULL_BACK, 0, 108); // Fill Triangle Array: Vert Array, Color Array, RDP Buffer, Culling, Base, Length
-
-    matrix_identity(Matrix3D); // Reset Matrix To Identity
-    translate_xyz(Matrix3D, CubeYellowPos[0], CubeYellowPos[1], CubeYellowPos[2]); // Translate: Matrix, X, Y, Z
-    rotate_xy(Matrix3D, Sin1024, XRot, YRot); // Rotate: Matrix, Precalc Table, X, Y
-    fill_text_triangle_array(CubeTri, CubeYellowCol, CULL_BACK, 0, 108); // Fill Triangle Array: Vert Array, Color Array, RDP Buffer, Culling, Base, Length
-
-    matrix_identity(Matrix3D); // Reset Matrix To Identity
-    translate_xyz(Matrix3D, CubePurplePos[0], CubePurplePos[1], CubePurplePos[2]); // Translate: Matrix, X, Y, Z
-    rotate_xz(Matrix3D, Sin1024, XRot, ZRot); // Rotate: Matrix, Precalc Table, X, Z
-    fill_text_triangle_array(CubeTri, CubePurpleCol, CULL_BACK, 0, 108); // Fill Triangle Array: Vert Array, Color Array, RDP Buffer, Culling, Base, Length
-
-    matrix_identity(Matrix3D); // Reset Matrix To Identity
-    translate_xyz(Matrix3D, CubeCyanPos[0], CubeCyanPos[1], CubeCyanPos[2]); // Translate: Matrix, X, Y, Z
-    rotate_xyz(Matrix3D, Sin1024, XRot, YRot, ZRot); // Rotate: Matrix, Precalc Table, X, Y, Z
-    fill_text_triangle_array(CubeTri, CubeCyanCol, CULL_BACK, 0, 108); // Fill Triangle Array: Vert Array, Color Array, RDP Buffer, Culling, Base, Length
+    // rotate_x(Matrix3D, Sin256, XRot); // Rotate: Matrix, Precalc Table, X
+    // rotate_y(Matrix3D, Sin256, YRot); // Rotate: Matrix, Precalc Table, Y
+    // rotate_z(Matrix3D, Sin256, ZRot); // Rotate: Matrix, Precalc Table, Z
+    // rotate_xy(Matrix3D, Sin256, XRot, YRot); // Rotate: Matrix, Precalc Table, X, Y
+    // rotate_xz(Matrix3D, Sin256, XRot, ZRot); // Rotate: Matrix, Precalc Table, X, Z
+    // rotate_yz(Matrix3D, Sin256, YRot, ZRot); // Rotate: Matrix, Precalc Table, Y, Z
+    // rotate_xyz(Matrix3D, Sin256, XRot, YRot, ZRot); // Rotate: Matrix, Precalc Table, X, Y, Z
+
+    for(uint32_t i = 0; i < CUBE_INSTANCES; i++) { // Every Cube Spins With The Shared Rotation Values
+      CubeInstance[i].rot[0] = XRot;
+      CubeInstance[i].rot[1] = YRot;
+      CubeInstance[i].rot[2] = ZRot;
+    }
+#if !IS_ZBUFFER
+    sort_instances(CubeInstance, CUBE_INSTANCES); // Painter's Order: Farthest Cube First
+#endif
+    fill_instances(&CubeMesh, CubeInstance, CUBE_INSTANCES, CULL_BACK, Sin256, fill_text_mesh); // Fill Instances: Mesh, Instances, Count, Culling, Precalc Table, Fill Function
 
     rdp_sync_full(); // EnsureEntireSceneIsFullyDrawn
 
-    rdp_run(rdp_start, memory_pos); // Run RDP buffer: Start, End
+    rdp_frame_end(); // Run RDP frame list: Start, End
 
     // Update triangle rotation variables
     XRot = (XRot + 1) & 1023;
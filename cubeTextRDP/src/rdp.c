@@ -1,27 +1,574 @@
 #include "rdp.h"
 
+/*** RDP COMMAND SINKS ***/
+#define RDP_SINK_RDRAM 0 // Command Sink: Store Words To RDRAM Through The Uncached KSEG1 Window (N64)
+#define RDP_SINK_HOST 1  // Command Sink: Append Words To A Growable Memory Buffer (Host Builds & Benchmarks)
+
+#ifndef RDP_SINK
+#define RDP_SINK RDP_SINK_RDRAM // Select With -DRDP_SINK=RDP_SINK_HOST To Build The Command Code With Plain GCC
+#endif
+
+#ifndef RDP_CACHED
+#define RDP_CACHED 0 // 1 = Build The RDP DRAM List Through Cached KSEG0 & Write Back Dirty Data Cache Lines In rdp_run
+#endif
+
+#ifndef RDP_FRAMES
+#define RDP_FRAMES 2 // Per-Frame Command Lists Used By rdp_frame_begin/rdp_frame_end (2 = Double Buffered)
+#endif
+
+#ifndef RDP_STATE_CACHE
+#define RDP_STATE_CACHE 1 // 1 = Drop Set Color/Other Modes/Combine Commands That Would Not Change The RDP State
+#endif
+
+#ifndef RDP_STATS
+#define RDP_STATS 0 // 1 = Walk Every Frame List In rdp_frame_end & Count 32-Bit Words Per Opcode
+#endif
+
+#define RDP_BUFFER_SIZE 131072 // RDP DRAM List Size In Bytes (TOP LIMIT)
+#define RDP_DCACHE_LINE 16 // VR4300 Data Cache Line Size In Bytes
+
+#if RDP_CACHED
+#define RDP_BUFFER_SEGMENT 0x80100000 // RDP DRAM List Through Cached KSEG0
+#else
+#define RDP_BUFFER_SEGMENT 0xA0100000 // RDP DRAM List Through Uncached KSEG1
+#endif
+
+#if RDP_SINK == RDP_SINK_HOST
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#endif
+
 /*** VARIABLES ***/
 uint32_t __bitdepth = BPP16; // FIX WITH VIDEO CHECK (needs to know if 16 or 32bit mode)
 static uint32_t memory_pos = 0; // RDP DRAM LIST
+static uint32_t memory_start = 0; // RDP DRAM LIST Region Being Built: Start
+static uint32_t memory_end = RDP_BUFFER_SIZE; // RDP DRAM LIST Region Being Built: End
+
+static uint32_t rdp_frame = 0; // Index Of The Per-Frame Command List Being Built
+static uint32_t rdp_frame_base = 0; // Start Of The First Per-Frame Command List
+static uint32_t rdp_frame_size = 0; // Size Of Each Per-Frame Command List In Bytes
+static uint32_t rdp_running = 0; // Set By The First rdp_run (Before That DPC_CURRENT Holds Whatever It Had At Boot)
+
+// RDP Command List Statistics (Readable From The ROM & Host Builds)
+typedef struct {
+  uint32_t capacity; // Size Of The Last Command List Region In Bytes
+  uint32_t frame_bytes; // Bytes Used By The Last Command List (Capacity If It Overflowed On RDRAM)
+  uint32_t high_water; // Largest frame_bytes Seen Since rdp_stats_reset
+  uint32_t overflow; // Set When The Current Command List Ran Past Its Region
+  uint32_t overflows; // Number Of Overflowed Command Lists Since rdp_stats_reset
+  uint32_t state_dropped; // Redundant State Commands Dropped From The Last Command List
+  uint32_t sync_inserted; // Syncs Inserted By The Sync Scheduler Into The Last Command List
+  uint32_t opcode_words[64]; // 32-Bit Words Per Opcode In The Last Command List (RDP_STATS Only)
+} RDPStats;
+
+static RDPStats rdp_stats = { RDP_BUFFER_SIZE, 0, 0, 0, 0, 0, 0, { 0 } };
+// RDP Sync Hazards (Work The RDP May Still Have In Flight When A Later Command Needs A Sync)
+#define RDP_HAZARD_PIPE 0x01 // A Primitive Was Drawn Since The Last Sync Pipe: Changing Render State Needs Sync Pipe
+#define RDP_HAZARD_TILE 0x02 // A Load Or Textured Primitive Used The Tile Descriptors: Set Tile Needs Sync Tile
+#define RDP_HAZARD_LOAD 0x04 // A Textured Primitive Read TMEM: Loading TMEM Needs Sync Load
+#define RDP_HAZARD_ALL 0x07
+
+static uint8_t rdp_sync_pending = RDP_HAZARD_ALL; // Hazards Not Yet Covered By A Sync (Unknown At Start)
+static uint32_t rdp_sync_inserted = 0; // Syncs Inserted Since The Current Command List Began
+
+// RDP State Shadow (Last Value Emitted For Each Cached State Register)
+#define RDP_STATE_FILL_COLOR 0x01
+#define RDP_STATE_FOG_COLOR 0x02
+#define RDP_STATE_BLEND_COLOR 0x04
+#define RDP_STATE_PRIM_COLOR 0x08
+#define RDP_STATE_ENV_COLOR 0x10
+#define RDP_STATE_OTHER_MODES 0x20
+#define RDP_STATE_COMBINE_MODE 0x40
+
+typedef struct {
+  uint32_t valid; // RDP_STATE_* Bits Of The Registers Whose Shadow Is Known
+  uint64_t fill_color, fog_color, blend_color, prim_color, env_color;
+  uint64_t other_modes, combine_mode;
+  uint32_t dropped; // Commands Dropped Since The Current Command List Began
+} RDPState;
+
+static RDPState rdp_state;
+
+static void (*rdp_overflow_callback)( uint32_t start, uint32_t end ) = 0; // Called Once Per Overflowed Command List
+
+#if RDP_SINK == RDP_SINK_HOST
+static uint32_t *rdp_host_buffer = NULL; // Host Command Buffer (Grows On Demand)
+static uint32_t rdp_host_size = 0; // Host Command Buffer Size In Bytes
+static uint32_t rdp_host_run_start = 0; // Start Of The Last List Passed To rdp_run
+static uint32_t rdp_host_run_end = 0; // End Of The Last List Passed To rdp_run
+static uint32_t rdp_host_run_count = 0; // Number Of rdp_run Calls
+static uint32_t rdp_host_wb_start = 0; // First Line Of The Last Modelled Data Cache Writeback
+static uint32_t rdp_host_wb_end = 0; // End (Exclusive) Of The Last Modelled Data Cache Writeback
+static uint32_t rdp_host_wb_lines = 0; // Total Data Cache Lines Written Back
+#endif
+
+/*** RDP COMMAND SINK ***/
+
+#if RDP_SINK == RDP_SINK_HOST
+// Host Sink: Grow The Buffer (Doubling) Until It Holds "size" Bytes
+static void rdp_host_reserve( uint32_t size )
+{
+    if( size <= rdp_host_size ) return;
+
+    uint32_t new_size = rdp_host_size ? rdp_host_size : 4096;
+    while( new_size < size ) new_size <<= 1;
+
+    uint32_t *buffer = realloc( rdp_host_buffer, new_size );
+    if( buffer == NULL ) abort();
+
+    for( uint32_t i = rdp_host_size >> 2; i < (new_size >> 2); i++ ) buffer[i] = 0;
+    rdp_host_buffer = buffer;
+    rdp_host_size = new_size;
+}
+
+// Host Sink: Release The Command Buffer
+void rdp_host_free( void )
+{
+    free( rdp_host_buffer );
+    rdp_host_buffer = NULL;
+    rdp_host_size = 0;
+}
+#endif
+
+// Get Command Word At Sink Position (Byte Offset Into The RDP DRAM List)
+static inline uint32_t *rdp_sink_word( uint32_t pos )
+{
+#if RDP_SINK == RDP_SINK_HOST
+    rdp_host_reserve( pos + 4 );
+    return &rdp_host_buffer[pos >> 2];
+#else
+    return (uint32_t *)(uintptr_t)(RDP_BUFFER_SEGMENT | pos);
+#endif
+}
+
+// Overwrite A Previously Emitted Command Word (Position From memory_pos)
+void rdp_patch( uint32_t pos, uint32_t data )
+{
+    *rdp_sink_word( pos ) = data;
+}
+
+// Read Back A Previously Emitted Command Word (Position From memory_pos)
+uint32_t rdp_peek( uint32_t pos )
+{
+#if RDP_SINK == RDP_SINK_HOST
+    // Byte Copy: The Word May Have Been Stored As Half Of A 64-Bit Command (See rdp_reserve)
+    uint32_t data;
+    memcpy( &data, rdp_sink_word( pos ), 4 );
+    return data;
+#else
+    return *rdp_sink_word( pos );
+#endif
+}
+
+#if RDP_SINK == RDP_SINK_HOST
+// Host Sink: Write [start, end) To A File As Big Endian Words, Laid Out As In RDRAM (Read By tools/rdpdis)
+int rdp_host_dump( const char *path, uint32_t start, uint32_t end )
+{
+    FILE *file = fopen( path, "wb" );
+    if( file == NULL ) return -1;
+
+    for( uint32_t pos = start; pos < end; pos += 4 ) {
+        uint32_t word = rdp_peek( pos );
+        uint8_t bytes[4] = { word >> 24, word >> 16, word >> 8, word };
+        fwrite( bytes, 1, 4, file );
+    }
+
+    return fclose( file ) == 0 ? 0 : -1;
+}
+#endif
+
+// Pack Two Command Words Into One 64-Bit Store (Keeps Word Order In Little-Endian Host Buffers)
+#if RDP_SINK == RDP_SINK_HOST && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define RDP_DWORD(hi, lo) ((uint64_t)(uint32_t)(lo) << 32 | (uint32_t)(hi))
+#else
+#define RDP_DWORD(hi, lo) ((uint64_t)(uint32_t)(hi) << 32 | (uint32_t)(lo))
+#endif
+
+// RDP Command Length In 64-Bit Words (From The First Word Of The Command)
+uint32_t rdp_command_length( uint32_t word )
+{
+    uint8_t op = (word >> 24) & 0x3F;
+
+    // Triangles: Edge Coefficients + Shade (Bit 2) + Texture (Bit 1) + Z-Buffer (Bit 0) Coefficients
+    if( op >= 0x08 && op <= 0x0F ) return 4 + ((op & 4) ? 8 : 0) + ((op & 2) ? 8 : 0) + ((op & 1) ? 2 : 0);
+
+    // Texture Rectangle & Texture Rectangle Flip
+    if( op == 0x24 || op == 0x25 ) return 2;
+
+    return 1;
+}
+
+#if RDP_SINK != RDP_SINK_HOST
+// Last Command Boundary In [start, end) (Drops A Command Cut By The Region End)
+static uint32_t rdp_command_boundary( uint32_t start, uint32_t end )
+{
+    uint32_t pos = start;
+    while( pos < end ) {
+        uint32_t size = rdp_command_length( rdp_peek( pos ) ) << 3;
+        if( pos + size > end ) break;
+        pos += size;
+    }
+    return pos;
+}
+
+static uint64_t rdp_discard[22]; // Dropped Primitives Are Built Here (Largest: Shade Texture Z-Buffer Triangle)
+#endif
+
+// Command List Overflow: Flag & Notify Once Per List (Returns 1 When Emitting Can Go On)
+// Host: Keep Growing To Measure The Whole List
+// RDRAM: Cut The List After Its Last Whole Command & Drop Every Further Word (Never Wrap Over The List)
+static int rdp_overflow( void )
+{
+    if( !rdp_stats.overflow ) {
+        rdp_stats.overflow = 1;
+        rdp_stats.overflows++;
+        if( rdp_overflow_callback ) rdp_overflow_callback( memory_start, memory_end );
+#if RDP_SINK != RDP_SINK_HOST
+        memory_pos = rdp_command_boundary( memory_start, memory_pos );
+        memory_end = memory_start; // Nothing Fits Any More (Even After rdp_list_append)
+#endif
+    }
+#if RDP_SINK == RDP_SINK_HOST
+    memory_end = 0xFFFFFFFF;
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+// Reserve Space For A Whole Primitive (Count Of 64-Bit Command Words)
+// One Capacity Check Per Primitive: A Primitive That Would Cross The Region End Is An Overflow
+static inline uint64_t *rdp_reserve( uint32_t count )
+{
+#if RDP_SINK == RDP_SINK_HOST
+    if( memory_pos + (count << 3) > memory_end ) rdp_overflow();
+    rdp_host_reserve( memory_pos + (count << 3) );
+#else
+    if( memory_pos + (count << 3) > memory_end && !rdp_overflow() ) return rdp_discard;
+#endif
+    return (uint64_t *)rdp_sink_word( memory_pos );
+}
+
+// Commit Reserved Command Words (Count Of 64-Bit Command Words)
+static inline void rdp_commit( uint32_t count )
+{
+#if RDP_SINK != RDP_SINK_HOST
+    if( rdp_stats.overflow ) return; // Built In rdp_discard
+#endif
+    memory_pos += count << 3;
+}
+
+// Data Cache Writeback Range: First Line Holding "start"
+static inline uint32_t rdp_writeback_first( uint32_t start )
+{
+    return start & ~(RDP_DCACHE_LINE - 1);
+}
+
+// Data Cache Writeback Range: End Of The Last Line Holding A Byte Before "end"
+static inline uint32_t rdp_writeback_last( uint32_t end )
+{
+    return (end + RDP_DCACHE_LINE - 1) & ~(RDP_DCACHE_LINE - 1);
+}
+
+// Write Back Dirty Data Cache Lines Of The RDP DRAM List (From Start Address To End Address)
+void rdp_writeback( uint32_t start, uint32_t end )
+{
+    if( end <= start ) return; // Empty List, Nothing Dirty
+
+    uint32_t first = rdp_writeback_first( start );
+    uint32_t last = rdp_writeback_last( end );
+
+#if RDP_SINK == RDP_SINK_HOST
+    // Host Sink: Model The Range, There Is No Data Cache To Flush
+    rdp_host_wb_start = first;
+    rdp_host_wb_end = last;
+    rdp_host_wb_lines += (last - first) / RDP_DCACHE_LINE;
+#else
+    // CACHE Hit_Writeback_D (0x19): Write A Dirty Line To RDRAM, Leave It Valid
+    for( uint32_t line = first; line < last; line += RDP_DCACHE_LINE )
+        __asm__ __volatile__( "cache 0x19, 0(%0)" :: "r"(RDP_BUFFER_SEGMENT | line) : "memory" );
+#endif
+}
+
+/*** RDP STATE CACHE ***/
+
+// Forget Shadowed State (New List, Patched List Or Raw Commands Of Unknown Effect)
+void rdp_state_invalidate( void )
+{
+    rdp_state.valid = 0;
+}
+
+// Returns 1 If The State Register Already Holds "value" (Command Dropped), Else Shadows It & Returns 0
+static inline int rdp_state_keep( uint32_t bit, uint64_t *shadow, uint64_t value )
+{
+#if RDP_STATE_CACHE
+    if( (rdp_state.valid & bit) && *shadow == value ) {
+        rdp_state.dropped++;
+        return 1;
+    }
+    rdp_state.valid |= bit;
+    *shadow = value;
+#else
+    (void)bit; (void)shadow; (void)value;
+#endif
+    return 0;
+}
+
+/*** RDP SYNC SCHEDULER ***/
+
+// Insert The Syncs A Command Depends On (Only For Hazards Still Pending)
+static inline void rdp_sync_before( uint8_t hazards )
+{
+    uint8_t pending = rdp_sync_pending & hazards;
+    if( !pending ) return;
+
+    // Reserve Only The Syncs Needed (A List With Room For Them Must Not Overflow)
+    uint32_t count = !!(pending & RDP_HAZARD_PIPE) + !!(pending & RDP_HAZARD_LOAD) + !!(pending & RDP_HAZARD_TILE);
+    uint64_t *cmd = rdp_reserve( count );
+    count = 0;
+    if( pending & RDP_HAZARD_PIPE ) cmd[count++] = RDP_DWORD( 0x27000000, 0x00000000 ); // Sync Pipe
+    if( pending & RDP_HAZARD_LOAD ) cmd[count++] = RDP_DWORD( 0x26000000, 0x00000000 ); // Sync Load
+    if( pending & RDP_HAZARD_TILE ) cmd[count++] = RDP_DWORD( 0x28000000, 0x00000000 ); // Sync Tile
+    rdp_commit( count );
+
+    rdp_sync_pending &= ~pending;
+    rdp_sync_inserted += count;
+}
+
+// Record The Hazards A Command Leaves Behind
+static inline void rdp_sync_after( uint8_t hazards )
+{
+    rdp_sync_pending |= hazards;
+}
 
 /*** RDP COMMANDS ***/
 
 // Create RDP commands
 void rdp_command( uint32_t data )
 {
-    *(uintptr_t *)(0xA0100000 | memory_pos) = data;
+    if( memory_pos + 4 > memory_end && !rdp_overflow() ) return; // TOP LIMIT: Word Dropped
+    *rdp_sink_word( memory_pos ) = data;
     memory_pos += 4; // 32 bit / 8
-    memory_pos = memory_pos % 131072; // TOP LIMIT
 }
 
 // Run RDP Command List (From Start Address To End Address)
 void rdp_run( uint32_t start, uint32_t end )
 {
+#if RDP_CACHED
+    // The List Was Built In Cached Memory, The RDP Only Sees RDRAM
+    rdp_writeback( start, end );
+#endif
+    rdp_running = 1;
+
+#if RDP_SINK == RDP_SINK_HOST
+    // Host Sink: Record The List Bounds, There Is No RDP To Kick
+    rdp_host_run_start = start;
+    rdp_host_run_end = end;
+    rdp_host_run_count++;
+#else
+    // The DP Latches Only One Pending List: Wait For The Previous One To Be Taken
+    while( *(volatile uint32_t *)DPC_STATUS & DPC_STATUS_START_VALID );
+
     // Store DPC Command Start Address To DP Start Register (0xA4100000)
-    *(uintptr_t *)0xA4100000 = 0xA0100000 | start;
+    *(uintptr_t *)DPC_START = 0xA0100000 | start;
 
     // Store DPC Command End Address To DP End Register (0xA4100004)
-    *(uintptr_t *)0xA4100004 = 0xA0100000 | end;
+    *(uintptr_t *)DPC_END = 0xA0100000 | end;
+#endif
+}
+
+/*** RDP COMMAND LIST STATISTICS ***/
+
+// Clear The High-Water Mark & Overflow Counters
+void rdp_stats_reset( void )
+{
+    rdp_stats.high_water = 0;
+    rdp_stats.overflows = 0;
+}
+
+// Set The Function Called Once Per Overflowed Command List (0 = None)
+void rdp_set_overflow_callback( void (*callback)( uint32_t start, uint32_t end ) )
+{
+    rdp_overflow_callback = callback;
+}
+
+// Account A Finished Command List (From Start Address To End Address)
+void rdp_stats_list( uint32_t start, uint32_t end )
+{
+    rdp_stats.frame_bytes = end - start;
+#if RDP_SINK != RDP_SINK_HOST
+    if( rdp_stats.overflow ) rdp_stats.frame_bytes = rdp_stats.capacity; // Commands Were Dropped, The True Size Is Lost
+#endif
+    if( rdp_stats.frame_bytes > rdp_stats.high_water ) rdp_stats.high_water = rdp_stats.frame_bytes;
+    rdp_stats.state_dropped = rdp_state.dropped;
+    rdp_stats.sync_inserted = rdp_sync_inserted;
+
+#if RDP_STATS
+    // Walk The List The Way The RDP Reads It
+    for( uint32_t op = 0; op < 64; op++ ) rdp_stats.opcode_words[op] = 0;
+    for( uint32_t pos = start; pos < end; ) {
+        uint32_t word = rdp_peek( pos );
+        uint32_t size = rdp_command_length( word ) << 3;
+        if( pos + size > end ) size = end - pos; // Truncated Command At The End Of The List
+        rdp_stats.opcode_words[(word >> 24) & 0x3F] += size >> 2;
+        pos += size;
+    }
+#endif
+}
+
+/*** RDP FRAME LISTS ***/
+
+// Wait Until The RDP Is No Longer Fetching Commands From [start, end)
+// An Idle RDP Can Leave DPC_CURRENT Anywhere (Inside The Region Too), So Only A Busy RDP Is Waited For
+static void rdp_fence( uint32_t start, uint32_t end )
+{
+#if RDP_SINK == RDP_SINK_HOST
+    // Host Sink: Lists Are Never Read Back, Nothing To Wait For
+    (void)start; (void)end;
+#else
+    if( !rdp_running ) return; // No List Submitted Yet: Nothing Can Be Reading The Region
+
+    uint32_t current;
+    do {
+        if( !(*(volatile uint32_t *)DPC_STATUS & (DPC_STATUS_DMA_BUSY | DPC_STATUS_CMD_BUSY)) ) return; // Idle: Every List Was Fetched & Run
+        current = (*(volatile uint32_t *)DPC_CURRENT & 0xFFFFFF) - 0x100000; // RDP DRAM List Offset
+    } while( current >= start && current < end );
+#endif
+}
+
+// Split The RDP DRAM List From "base" To The TOP LIMIT Into RDP_FRAMES Per-Frame Command Lists
+void rdp_frames_init( uint32_t base )
+{
+    rdp_frame_base = base;
+    rdp_frame_size = ((RDP_BUFFER_SIZE - base) / RDP_FRAMES) & ~7; // Keep Lists 64-Bit Aligned
+    rdp_frame = RDP_FRAMES - 1; // First rdp_frame_begin Uses List 0
+}
+
+// Begin The Next Per-Frame Command List, Once The RDP Has Left It (Returns The List Start)
+// The CPU Builds Frame N+1 While The RDP Still Drains Frame N From Another List
+uint32_t rdp_frame_begin( void )
+{
+    rdp_frame = (rdp_frame + 1) % RDP_FRAMES;
+    memory_start = rdp_frame_base + rdp_frame * rdp_frame_size;
+    memory_end = memory_start + rdp_frame_size;
+
+    rdp_fence( memory_start, memory_end );
+
+    rdp_stats.capacity = rdp_frame_size;
+    rdp_stats.overflow = 0;
+    rdp_state.dropped = 0;
+    rdp_sync_inserted = 0;
+    rdp_state_invalidate();
+    memory_pos = memory_start;
+    return memory_pos;
+}
+
+// End The Per-Frame Command List & Hand It To The RDP
+void rdp_frame_end( void )
+{
+    rdp_stats_list( memory_start, memory_pos );
+    rdp_run( memory_start, memory_pos );
+}
+
+/*** RDP DISPLAY LISTS ***/
+
+// Recorded Display List (Built Once, Then Replayed With Only Its Patch Points Updated)
+typedef struct {
+  uint32_t start; // Start Of The Recorded List In The RDP DRAM List
+  uint32_t end; // End Of The Recorded List
+  uint8_t sync_pending; // Sync Hazards Left Pending At The End Of The Recorded List
+} RDPList;
+
+// Begin Recording A Display List At The Current Position
+void rdp_list_begin( RDPList *list )
+{
+    list->start = memory_pos;
+    list->end = memory_pos;
+    list->sync_pending = RDP_HAZARD_ALL;
+    rdp_sync_pending = RDP_HAZARD_ALL; // Whatever Runs Before A Replayed List Is Unknown
+    rdp_state_invalidate();
+}
+
+// End Recording A Display List
+void rdp_list_end( RDPList *list )
+{
+    list->end = memory_pos;
+    list->sync_pending = rdp_sync_pending;
+}
+
+// Continue Emitting Commands Right After A Recorded Display List
+void rdp_list_append( RDPList *list )
+{
+    memory_pos = list->end;
+    rdp_sync_pending = list->sync_pending;
+    rdp_state_invalidate();
+}
+
+// Patch Point: Position Of The Next Command (Take It Just Before Emitting The Command To Patch)
+// The State Cache Is Forgotten So The Marked Command Is Always Emitted
+uint32_t rdp_list_mark( void )
+{
+    rdp_state_invalidate();
+    return memory_pos;
+}
+
+// Patch Point: DRAM Address Of A Set Color/Z/Texture Image Command
+void rdp_patch_address( uint32_t mark, uint32_t address )
+{
+    rdp_patch( mark + 4, address );
+}
+
+// Patch Point: Coordinates Of A Fill/Texture Rectangle Command (Opcode & Tile Are Kept)
+void rdp_patch_rectangle( uint32_t mark, float xh, float yh, float xl, float yl )
+{
+    rdp_patch( mark, (rdp_peek( mark ) & 0xFF000000) | ((int)(xl * 4.0) & 0xFFF) << 12 | ((int)(yl * 4.0) & 0xFFF) );
+    rdp_patch( mark + 4, (rdp_peek( mark + 4 ) & 0xFF000000) | ((int)(xh * 4.0) & 0xFFF) << 12 | ((int)(yh * 4.0) & 0xFFF) );
+}
+
+// Patch Point: Texture Coordinates Of A Texture Rectangle Command
+void rdp_patch_rectangle_st( uint32_t mark, float s, float t, float dsdx, float dtdy )
+{
+    rdp_patch( mark + 8, (int)(s * 32.0) << 16 | ((int)(t * 32.0) & 0xFFFF) );
+    rdp_patch( mark + 12, (int)(dsdx * 1024.0) << 16 | ((int)(dtdy * 1024.0) & 0xFFFF) );
+}
+
+// Patch Point: Color Of A Set Fog/Blend/Primitive/Environment Color Command
+void rdp_patch_color( uint32_t mark, uint8_t r, uint8_t g, uint8_t b, uint8_t a )
+{
+    rdp_state_invalidate();
+    rdp_patch( mark + 4, r << 24 | g << 16 | b << 8 | a );
+}
+
+// Pack A Fill Color For The Current Bit Depth (R,G,B,A)
+uint32_t rdp_fill_color_word( uint8_t r, uint8_t g, uint8_t b, uint8_t a )
+{
+    uint32_t color;
+	
+    if( __bitdepth == BPP16 )
+    {
+        // 8 to 5 bit (RGB555)
+        r = r >> 3;
+        g = g >> 3;
+        b = b >> 3;
+        a = a >> 7;
+		
+        // Pack Color Twice For 16BPP Mode
+        color = r << 11 | g << 6 | b << 1 | a;
+        color = color | color << 16;
+    }
+    else
+        color = r << 24 | g << 16 | b << 8 | a;
+
+    return color;
+}
+
+// Patch Point: Color Of A Set Fill Color Command
+void rdp_patch_fill_color( uint32_t mark, uint8_t r, uint8_t g, uint8_t b, uint8_t a )
+{
+    rdp_state_invalidate();
+    rdp_patch( mark + 4, rdp_fill_color_word( r, g, b, a ) );
 }
 
 // No Op (No Operation)
@@ -34,19 +581,21 @@ void rdp_no_op( void )
 // Fill Triangle (Flat Non-Shaded) Edge Coefficients
 void rdp_fill_triangle( uint8_t lft, uint8_t level, uint8_t tile, float yl, float ym, float yh, float xl, float dxldy, float xh, float dxhdy, float xm, float dxmdy )
 {
-    rdp_command( 0x08000000 | lft << 23 | level << 19 | tile << 16 | ((int)(yl * 4.0) & 0x3FFF) );
-    rdp_command( ((int)(ym * 4.0) & 0x3FFF) << 16 | ((int)(yh * 4.0) & 0x3FFF) );
-    rdp_command( (int)(xl * 65536.0) );
-    rdp_command( (int)(dxldy * 65536.0) );
-    rdp_command( (int)(xh * 65536.0) );
-    rdp_command( (int)(dxhdy * 65536.0) );
-    rdp_command( (int)(xm * 65536.0) );
-    rdp_command( (int)(dxmdy * 65536.0) );
+    rdp_sync_after( RDP_HAZARD_PIPE );
+
+    uint64_t *cmd = rdp_reserve( 4 );
+    cmd[0] = RDP_DWORD( 0x08000000 | lft << 23 | level << 19 | tile << 16 | ((int)(yl * 4.0) & 0x3FFF), ((int)(ym * 4.0) & 0x3FFF) << 16 | ((int)(yh * 4.0) & 0x3FFF) );
+    cmd[1] = RDP_DWORD( (int)(xl * 65536.0), (int)(dxldy * 65536.0) );
+    cmd[2] = RDP_DWORD( (int)(xh * 65536.0), (int)(dxhdy * 65536.0) );
+    cmd[3] = RDP_DWORD( (int)(xm * 65536.0), (int)(dxmdy * 65536.0) );
+    rdp_commit( 4 );
 }
 
 // Fill Z-Buffer Triangle (Flat Non-Shaded Z-Buffered) Edge Coefficients
 void rdp_fill_zbuffer_triangle( uint8_t lft, uint8_t level, uint8_t tile, float yl, float ym, float yh, float xl, float dxldy, float xh, float dxhdy, float xm, float dxmdy )
 {
+    rdp_sync_after( RDP_HAZARD_PIPE );
+
     rdp_command( 0x09000000 | lft << 23 | level << 19 | tile << 16 | ((int)(yl * 4.0) & 0x3FFF) );
     rdp_command( ((int)(ym * 4.0) & 0x3FFF) << 16 | ((int)(yh * 4.0) & 0x3FFF) );
     rdp_command( (int)(xl * 65536.0) );
@@ -60,6 +609,8 @@ void rdp_fill_zbuffer_triangle( uint8_t lft, uint8_t level, uint8_t tile, float
 // Texture Triangle (Textured Non-Shaded) Edge Coefficients
 void rdp_texture_triangle( uint8_t lft, uint8_t level, uint8_t tile, float yl, float ym, float yh, float xl, float dxldy, float xh, float dxhdy, float xm, float dxmdy )
 {
+    rdp_sync_after( RDP_HAZARD_ALL );
+
     rdp_command( 0x0A000000 | lft << 23 | level << 19 | tile << 16 | ((int)(yl * 4.0) & 0x3FFF) );
     rdp_command( ((int)(ym * 4.0) & 0x3FFF) << 16 | ((int)(yh * 4.0) & 0x3FFF) );
     rdp_command( (int)(xl * 65536.0) );
@@ -73,6 +624,8 @@ void rdp_texture_triangle( uint8_t lft, uint8_t level, uint8_t tile, float yl, f
 // Texture Z-Buffer Triangle (Textured Non-Shaded Z-Buffered) Edge Coefficients
 void rdp_texture_zbuffer_triangle( uint8_t lft, uint8_t level, uint8_t tile, float yl, float ym, float yh, float xl, float dxldy, float xh, float dxhdy, float xm, float dxmdy )
 {
+    rdp_sync_after( RDP_HAZARD_ALL );
+
     rdp_command( 0x0B000000 | lft << 23 | level << 19 | tile << 16 | ((int)(yl * 4.0) & 0x3FFF) );
     rdp_command( ((int)(ym * 4.0) & 0x3FFF) << 16 | ((int)(yh * 4.0) & 0x3FFF) );
     rdp_command( (int)(xl * 65536.0) );
@@ -86,6 +639,8 @@ void rdp_texture_zbuffer_triangle( uint8_t lft, uint8_t level, uint8_t tile, flo
 // Shade Triangle (Goraud Shaded) Edge Coefficients
 void rdp_shade_triangle( uint8_t lft, uint8_t level, uint8_t tile, float yl, float ym, float yh, float xl, float dxldy, float xh, float dxhdy, float xm, float dxmdy )
 {
+    rdp_sync_after( RDP_HAZARD_PIPE );
+
     rdp_command( 0x0C000000 | lft << 23 | level << 19 | tile << 16 | ((int)(yl * 4.0) & 0x3FFF) );
     rdp_command( ((int)(ym * 4.0) & 0x3FFF) << 16 | ((int)(yh * 4.0) & 0x3FFF) );
     rdp_command( (int)(xl * 65536.0) );
@@ -99,6 +654,8 @@ void rdp_shade_triangle( uint8_t lft, uint8_t level, uint8_t tile, float yl, flo
 // Shade Z-Buffer Triangle (Goraud Shaded Z-Buffered) Edge Coefficients
 void rdp_shade_zbuffer_triangle( uint8_t lft, uint8_t level, uint8_t tile, float yl, float ym, float yh, float xl, float dxldy, float xh, float dxhdy, float xm, float dxmdy )
 {
+    rdp_sync_after( RDP_HAZARD_PIPE );
+
     rdp_command( 0x0D000000 | lft << 23 | level << 19 | tile << 16 | ((int)(yl * 4.0) & 0x3FFF) );
     rdp_command( ((int)(ym * 4.0) & 0x3FFF) << 16 | ((int)(yh * 4.0) & 0x3FFF) );
     rdp_command( (int)(xl * 65536.0) );
@@ -112,6 +669,8 @@ void rdp_shade_zbuffer_triangle( uint8_t lft, uint8_t level, uint8_t tile, float
 // Shade Texture Triangle (Goraud Shaded Textured) Edge Coefficients
 void rdp_shade_texture_triangle( uint8_t lft, uint8_t level, uint8_t tile, float yl, float ym, float yh, float xl, float dxldy, float xh, float dxhdy, float xm, float dxmdy )
 {
+    rdp_sync_after( RDP_HAZARD_ALL );
+
     rdp_command( 0x0E000000 | lft << 23 | level << 19 | tile << 16 | ((int)(yl * 4.0) & 0x3FFF) );
     rdp_command( ((int)(ym * 4.0) & 0x3FFF) << 16 | ((int)(yh * 4.0) & 0x3FFF) );
     rdp_command( (int)(xl * 65536.0) );
@@ -125,6 +684,8 @@ void rdp_shade_texture_triangle( uint8_t lft, uint8_t level, uint8_t tile, float
 // Shade Texture Z-Buffer Triangle (Goraud Shaded Textured Z-Buffered) Edge Coefficients
 void rdp_shade_texture_zbuffer_triangle( uint8_t lft, uint8_t level, uint8_t tile, float yl, float ym, float yh, float xl, float dxldy, float xh, float dxhdy, float xm, float dxmdy )
 {
+    rdp_sync_after( RDP_HAZARD_ALL );
+
     rdp_command( 0x0F000000 | lft << 23 | level << 19 | tile << 16 | ((int)(yl * 4.0) & 0x3FFF) );
     rdp_command( ((int)(ym * 4.0) & 0x3FFF) << 16 | ((int)(yh * 4.0) & 0x3FFF) );
     rdp_command( (int)(xl * 65536.0) );
@@ -135,46 +696,61 @@ void rdp_shade_texture_zbuffer_triangle( uint8_t lft, uint8_t level, uint8_t til
     rdp_command( (int)(dxmdy * 65536.0) );
 }
 
+// Fixed Point Formats Used By The Integer Triangle Encoders
+#define RDP_S15_16(x) ((int32_t)((x) * 65536.0)) // X & Inverse Slope: Signed 15.16 (Truncated Like The Float Encoders)
+#define RDP_S11_2(y) ((int32_t)((y) * 4.0)) // Y & Vertex Coordinates: Signed 11.2 (Quarter Pixels)
+#define RDP_INT_PAIR(a, b) (((uint32_t)(a) & 0xFFFF0000) | (uint32_t)(b) >> 16) // Integer Halves Of Two S15.16 Coefficients
+#define RDP_FRAC_PAIR(a, b) ((uint32_t)(a) << 16 | ((uint32_t)(b) & 0xFFFF)) // Fraction Halves Of Two S15.16 Coefficients
+
+// Triangle Edge Coefficients From Fixed Point Values (Any Triangle Command 0x08..0x0F, YL/YM/YH S11.2, X & DxDy S15.16)
+void rdp_triangle_fx( uint8_t command, uint8_t lft, uint8_t level, uint8_t tile, int32_t yl, int32_t ym, int32_t yh, int32_t xl, int32_t dxldy, int32_t xh, int32_t dxhdy, int32_t xm, int32_t dxmdy )
+{
+    rdp_sync_after( (command & 0x02) ? RDP_HAZARD_ALL : RDP_HAZARD_PIPE ); // Textured Triangles Also Use Tiles & TMEM
+
+    uint64_t *cmd = rdp_reserve( 4 );
+    cmd[0] = RDP_DWORD( (uint32_t)(command & 0x3F) << 24 | lft << 23 | level << 19 | tile << 16 | (yl & 0x3FFF), (ym & 0x3FFF) << 16 | (yh & 0x3FFF) );
+    cmd[1] = RDP_DWORD( xl, dxldy );
+    cmd[2] = RDP_DWORD( xh, dxhdy );
+    cmd[3] = RDP_DWORD( xm, dxmdy );
+    rdp_commit( 4 );
+}
+
+// Shade/Texture Coefficient Block (8 64-Bit Words): 4 Lanes Of Start Value, DxDx, DxDe & DxDy (Texture Lanes: S, T, W, 0)
+// Each Value Is Converted To S15.16 Once & Split Into Its Halves, So A Negative Fraction Keeps Its Floored Integer (-0.25 = 0xFFFF.C000)
+static inline void rdp_attribute_block( uint64_t *cmd, const float value[4], const float dx[4], const float de[4], const float dy[4] )
+{
+    int32_t v_fx[4], dx_fx[4], de_fx[4], dy_fx[4];
+    for( int i = 0; i < 4; i++ ) {
+        v_fx[i] = RDP_S15_16( value[i] );
+        dx_fx[i] = RDP_S15_16( dx[i] );
+        de_fx[i] = RDP_S15_16( de[i] );
+        dy_fx[i] = RDP_S15_16( dy[i] );
+    }
+
+    cmd[0] = RDP_DWORD( RDP_INT_PAIR( v_fx[0], v_fx[1] ), RDP_INT_PAIR( v_fx[2], v_fx[3] ) );
+    cmd[1] = RDP_DWORD( RDP_INT_PAIR( dx_fx[0], dx_fx[1] ), RDP_INT_PAIR( dx_fx[2], dx_fx[3] ) );
+    cmd[2] = RDP_DWORD( RDP_FRAC_PAIR( v_fx[0], v_fx[1] ), RDP_FRAC_PAIR( v_fx[2], v_fx[3] ) );
+    cmd[3] = RDP_DWORD( RDP_FRAC_PAIR( dx_fx[0], dx_fx[1] ), RDP_FRAC_PAIR( dx_fx[2], dx_fx[3] ) );
+    cmd[4] = RDP_DWORD( RDP_INT_PAIR( de_fx[0], de_fx[1] ), RDP_INT_PAIR( de_fx[2], de_fx[3] ) );
+    cmd[5] = RDP_DWORD( RDP_INT_PAIR( dy_fx[0], dy_fx[1] ), RDP_INT_PAIR( dy_fx[2], dy_fx[3] ) );
+    cmd[6] = RDP_DWORD( RDP_FRAC_PAIR( de_fx[0], de_fx[1] ), RDP_FRAC_PAIR( de_fx[2], de_fx[3] ) );
+    cmd[7] = RDP_DWORD( RDP_FRAC_PAIR( dy_fx[0], dy_fx[1] ), RDP_FRAC_PAIR( dy_fx[2], dy_fx[3] ) );
+}
+
 // Shade Coefficients (Concat With Triangle Edge Coefficients Commands)
 void rdp_shade_coefficients( float r, float g, float b, float a, float drdx, float dgdx, float dbdx, float dadx, float drde, float dgde, float dbde, float dade, float drdy, float dgdy, float dbdy, float dady )
 {
-    rdp_command( (int)(r) << 16 | ((int)(g) & 0xFFFF) );
-    rdp_command( (int)(b) << 16 | ((int)(a) & 0xFFFF) );
-    rdp_command( (int)(drdx) << 16 | ((int)(dgdx) & 0xFFFF) );
-    rdp_command( (int)(dbdx) << 16 | ((int)(dadx) & 0xFFFF) );
-    rdp_command( (int)(r * 65536.0) << 16 | ((int)(g * 65536.0) & 0xFFFF) );
-    rdp_command( (int)(b * 65536.0) << 16 | ((int)(a * 65536.0) & 0xFFFF) );
-    rdp_command( (int)(drdx * 65536.0) << 16 | ((int)(dgdx * 65536.0) & 0xFFFF) );
-    rdp_command( (int)(dbdx * 65536.0) << 16 | ((int)(dadx * 65536.0) & 0xFFFF) );
-    rdp_command( (int)(drde) << 16 | ((int)(dgde) & 0xFFFF) );
-    rdp_command( (int)(dbde) << 16 | ((int)(dade) & 0xFFFF) );
-    rdp_command( (int)(drdy) << 16 | ((int)(dgdy) & 0xFFFF) );
-    rdp_command( (int)(dbdy) << 16 | ((int)(dady) & 0xFFFF) );
-    rdp_command( (int)(drde * 65536.0) << 16 | ((int)(dgde * 65536.0) & 0xFFFF) );
-    rdp_command( (int)(dbde * 65536.0) << 16 | ((int)(dade * 65536.0) & 0xFFFF) );
-    rdp_command( (int)(drdy * 65536.0) << 16 | ((int)(dgdy * 65536.0) & 0xFFFF) );
-    rdp_command( (int)(dbdy * 65536.0) << 16 | ((int)(dady * 65536.0) & 0xFFFF) );
+    const float value[4] = { r, g, b, a }, dx[4] = { drdx, dgdx, dbdx, dadx }, de[4] = { drde, dgde, dbde, dade }, dy[4] = { drdy, dgdy, dbdy, dady };
+    rdp_attribute_block( rdp_reserve( 8 ), value, dx, de, dy );
+    rdp_commit( 8 );
 }
 
 // Texture Coefficients (Concat With Triangle Edge Coefficients Commands)
 void rdp_texture_coefficients( float s, float t, float w, float dsdx, float dtdx, float dwdx, float dsde, float dtde, float dwde, float dsdy, float dtdy, float dwdy )
 {
-    rdp_command( (int)(s) << 16 | ((int)(t) & 0xFFFF) );
-    rdp_command( (int)(w) << 16 );
-    rdp_command( (int)(dsdx) << 16 | ((int)(dtdx) & 0xFFFF) );
-    rdp_command( (int)(dwdx) << 16 );
-    rdp_command( (int)(s * 65536.0) << 16 | ((int)(t * 65536.0) & 0xFFFF) );
-    rdp_command( (int)(w * 65536.0) << 16 );
-    rdp_command( (int)(dsdx * 65536.0) << 16 | ((int)(dtdx * 65536.0) & 0xFFFF) );
-    rdp_command( (int)(dwdx * 65536.0) << 16 );
-    rdp_command( (int)(dsde) << 16 | ((int)(dtde) & 0xFFFF) );
-    rdp_command( (int)(dwde) << 16 );
-    rdp_command( (int)(dsdy) << 16 | ((int)(dtdy) & 0xFFFF) );
-    rdp_command( (int)(dwdy) << 16 );
-    rdp_command( (int)(dsde * 65536.0) << 16 | ((int)(dtde * 65536.0) & 0xFFFF) );
-    rdp_command( (int)(dwde * 65536.0) << 16 );
-    rdp_command( (int)(dsdy * 65536.0) << 16 | ((int)(dtdy * 65536.0) & 0xFFFF) );
-    rdp_command( (int)(dwdy * 65536.0) << 16 );
+    const float value[4] = { s, t, w, 0 }, dx[4] = { dsdx, dtdx, dwdx, 0 }, de[4] = { dsde, dtde, dwde, 0 }, dy[4] = { dsdy, dtdy, dwdy, 0 };
+    rdp_attribute_block( rdp_reserve( 8 ), value, dx, de, dy );
+    rdp_commit( 8 );
 }
 
 // Z-Buffer Coefficients (Concat With Triangle Edge Coefficients Commands)
@@ -189,6 +765,8 @@ void rdp_zbuffer_coefficients( float z, float dzdx, float dzde, float dzdy )
 // Texture Rectangle (Top Left To Bottom Right)
 void rdp_texture_rectangle( float xh, float yh, float xl, float yl, float s, float t, float dsdx, float dtdy, uint8_t tile )
 {
+    rdp_sync_after( RDP_HAZARD_ALL );
+
     rdp_command( 0x24000000 | ((int)(xl * 4.0) & 0xFFF) << 12 | ((int)(yl * 4.0) & 0xFFF) ); 
     rdp_command( tile << 24 | ((int)(xh * 4.0) & 0xFFF) << 12 | ((int)(yh * 4.0) & 0xFFF) );
     rdp_command( (int)(s * 32.0) << 16 | ((int)(t * 32.0) & 0xFFFF) );
@@ -198,6 +776,8 @@ void rdp_texture_rectangle( float xh, float yh, float xl, float yl, float s, flo
 // Texture Rectangle Flip (Top Left To Bottom Right)
 void rdp_texture_rectangle_flip( float xh, float yh, float xl, float yl, float s, float t, float dsdx, float dtdy, uint8_t tile )
 {
+    rdp_sync_after( RDP_HAZARD_ALL );
+
     rdp_command( 0x25000000 | ((int)(xl * 4.0) & 0xFFF) << 12 | ((int)(yl * 4.0) & 0xFFF) ); 
     rdp_command( tile << 24 | ((int)(xh * 4.0) & 0xFFF) << 12 | ((int)(yh * 4.0) & 0xFFF) );
     rdp_command( (int)(s * 32.0) << 16 | ((int)(t * 32.0) & 0xFFFF) );
@@ -207,6 +787,8 @@ void rdp_texture_rectangle_flip( float xh, float yh, float xl, float yl, float s
 // Sync Load
 void rdp_sync_load( void )
 {
+    rdp_sync_pending &= ~RDP_HAZARD_LOAD;
+
     rdp_command( 0x26000000 );
     rdp_command( 0x00000000 );
 }
@@ -214,6 +796,8 @@ void rdp_sync_load( void )
 // Sync Pipe
 void rdp_sync_pipe( void )
 {
+    rdp_sync_pending &= ~RDP_HAZARD_PIPE;
+
     rdp_command( 0x27000000 );
     rdp_command( 0x00000000 );
 }
@@ -221,6 +805,8 @@ void rdp_sync_pipe( void )
 // Sync Tile
 void rdp_sync_tile( void )
 {
+    rdp_sync_pending &= ~RDP_HAZARD_TILE;
+
     rdp_command( 0x28000000 );
     rdp_command( 0x00000000 );
 }
@@ -228,6 +814,8 @@ void rdp_sync_tile( void )
 // Sync Full
 void rdp_sync_full( void )
 {
+    rdp_sync_pending &= ~RDP_HAZARD_ALL;
+
     rdp_command( 0x29000000 );
     rdp_command( 0x00000000 );
 }
@@ -235,6 +823,8 @@ void rdp_sync_full( void )
 // Set Key GB (Coefficients Used For Green/Blue Keying)
 void rdp_set_key_gb( float widthg, uint8_t centerg, uint8_t scaleg, float widthb, uint8_t centerb, uint8_t scaleb )
 {
+    rdp_sync_before( RDP_HAZARD_PIPE );
+
     rdp_command( 0x2A000000 | ((int)(widthg * 16.0) & 0xFFF) << 12 | ((int)(widthb * 16.0) & 0xFFF) );
     rdp_command( centerg << 24 | scaleg << 16 | centerb << 8 | scaleb );
 }
@@ -242,6 +832,8 @@ void rdp_set_key_gb( float widthg, uint8_t centerg, uint8_t scaleg, float widthb
 // Set Key R (Coefficients Used For Red Keying)
 void rdp_set_key_r( float width, uint8_t center, uint8_t scale )
 {
+    rdp_sync_before( RDP_HAZARD_PIPE );
+
     rdp_command( 0x2B000000 );
     rdp_command( (int)(width * 16.0) << 16 | center << 8 | scale );
 }
@@ -249,6 +841,8 @@ void rdp_set_key_r( float width, uint8_t center, uint8_t scale )
 // Set Convert (Coefficients For Converting YUV Pixels To RGB)
 void rdp_set_convert( float k0, float k1, float k2, float k3, float k4, float k5 )
 {
+    rdp_sync_before( RDP_HAZARD_PIPE );
+
     rdp_command( 0x2C000000 | ((int)(k0 * 128.0) & 0x1FF) << 13 | ((int)(k1 * 128.0) & 0x1FF) << 4 | ((int)(k2 * 128.0) & 0x1FF) >> 5 );
     rdp_command( (int)(k2 * 128.0) << 27 | ((int)(k3 * 128.0) & 0x1FF) << 18 | ((int)(k4 * 128.0) & 0x1FF) << 9 | ((int)(k5 * 128.0) & 0x1FF) );
 }
@@ -256,6 +850,8 @@ void rdp_set_convert( float k0, float k1, float k2, float k3, float k4, float k5
 // Set Scissor (Top Left To Bottom Right)
 void rdp_set_scissor( float xh, float yh, float xl, float yl, uint8_t f, uint8_t o )
 {
+    rdp_sync_before( RDP_HAZARD_PIPE );
+
     rdp_command( 0x2D000000 | ((int)(xh * 4.0) & 0xFFF) << 12 | ((int)(yh * 4.0) & 0xFFF) );
     rdp_command( f << 25 | o << 24 | ((int)(xl * 4.0) & 0xFFF) << 12 | ((int)(yl * 4.0) & 0xFFF) );
 }
@@ -263,6 +859,8 @@ void rdp_set_scissor( float xh, float yh, float xl, float yl, uint8_t f, uint8_t
 // Set Primitive Depth (Primitive Z, Primitive Delta Z)
 void rdp_set_prim_depth( float z, float dz )
 {
+    rdp_sync_before( RDP_HAZARD_PIPE );
+
     rdp_command( 0x2E000000 );
     rdp_command( (int)(z) << 16 | ((int)(dz) & 0xFFFF) );
 }
@@ -273,13 +871,20 @@ void rdp_set_other_modes( uint64_t mode )
     uint32_t mode_hi = mode >> 32;
     uint32_t mode_lo = mode & 0xFFFFFFFF;
 
-    rdp_command( 0x2F000000 | mode_hi );
-    rdp_command( mode_lo );
+    if( rdp_state_keep( RDP_STATE_OTHER_MODES, &rdp_state.other_modes, mode ) ) return;
+    rdp_sync_before( RDP_HAZARD_PIPE );
+
+    uint64_t *cmd = rdp_reserve( 1 );
+    cmd[0] = RDP_DWORD( 0x2F000000 | mode_hi, mode_lo );
+    rdp_commit( 1 );
 }
 
 // Load TLUT (Top Left To Bottom Right)
 void rdp_load_tlut( float sl, float tl, float sh, float th, uint8_t tile )
 {
+    rdp_sync_before( RDP_HAZARD_LOAD );
+    rdp_sync_after( RDP_HAZARD_TILE );
+
     rdp_command( 0x30000000 | ((int)(sl * 4.0) & 0xFFF) << 12 | ((int)(tl * 4.0) & 0xFFF) ); 
     rdp_command( tile << 24 | ((int)(sh * 4.0) & 0xFFF) << 12 | ((int)(th * 4.0) & 0xFFF) );
 }
@@ -287,6 +892,8 @@ void rdp_load_tlut( float sl, float tl, float sh, float th, uint8_t tile )
 // Set Tile Size (Top Left To Bottom Right)
 void rdp_set_tile_size( float sl, float tl, float sh, float th, uint8_t tile )
 {
+    rdp_sync_before( RDP_HAZARD_TILE );
+
     rdp_command( 0x32000000 | ((int)(sl * 4.0) & 0xFFF) << 12 | ((int)(tl * 4.0) & 0xFFF) ); 
     rdp_command( tile << 24 | ((int)(sh * 4.0) & 0xFFF) << 12 | ((int)(th * 4.0) & 0xFFF) );
 }
@@ -294,6 +901,9 @@ void rdp_set_tile_size( float sl, float tl, float sh, float th, uint8_t tile )
 // Load Block (Top Left To Bottom Right)
 void rdp_load_block( float sl, float tl, float sh, float dxt, uint8_t tile )
 {
+    rdp_sync_before( RDP_HAZARD_LOAD );
+    rdp_sync_after( RDP_HAZARD_TILE );
+
     rdp_command( 0x33000000 | ((int)(sl) & 0xFFF) << 12 | ((int)(tl) & 0xFFF) ); 
     rdp_command( tile << 24 | ((int)(sh) & 0xFFF) << 12 | ((int)(dxt * 2048.0) & 0xFFF) );
 }
@@ -301,6 +911,9 @@ void rdp_load_block( float sl, float tl, float sh, float dxt, uint8_t tile )
 // Load Tile (Top Left To Bottom Right)
 void rdp_load_tile( float sl, float tl, float sh, float th, uint8_t tile )
 {
+    rdp_sync_before( RDP_HAZARD_LOAD );
+    rdp_sync_after( RDP_HAZARD_TILE );
+
     rdp_command( 0x34000000 | ((int)(sl * 4.0) & 0xFFF) << 12 | ((int)(tl * 4.0) & 0xFFF) ); 
     rdp_command( tile << 24 | ((int)(sh * 4.0) & 0xFFF) << 12 | ((int)(th * 4.0) & 0xFFF) );
 }
@@ -308,6 +921,8 @@ void rdp_load_tile( float sl, float tl, float sh, float th, uint8_t tile )
 // Set Tile (Command Format)
 void rdp_set_tile( uint8_t format, uint8_t size, uint16_t line, uint16_t tmem, uint8_t tile, uint8_t palette, uint8_t ct, uint8_t mt, uint8_t maskt, uint8_t shiftt, uint8_t cs, uint8_t ms, uint8_t masks, uint8_t shifts )
 {
+    rdp_sync_before( RDP_HAZARD_TILE );
+
     rdp_command( 0x35000000 | format << 21 | size << 19 | line << 9 | tmem ); 
     rdp_command( tile << 24 | palette << 20 | ct << 19 | mt << 18 | maskt << 14 | shiftt << 10 | cs << 9 | ms << 8 | masks << 4 | shifts );
 }
@@ -315,68 +930,83 @@ void rdp_set_tile( uint8_t format, uint8_t size, uint16_t line, uint16_t tmem, u
 // Fill Rectangle (Top Left To Bottom Right)
 void rdp_fill_rectangle( float xh, float yh, float xl, float yl )
 {
+    rdp_sync_after( RDP_HAZARD_PIPE );
+
     rdp_command( 0x36000000 | ((int)(xl * 4.0) & 0xFFF) << 12 | ((int)(yl * 4.0) & 0xFFF) ); 
     rdp_command( ((int)(xh * 4.0) & 0xFFF) << 12 | ((int)(yh * 4.0) & 0xFFF) );
 }
 
-// Set Fill Color (R,G,B,A)
-void rdp_set_fill_color( uint8_t r, uint8_t g, uint8_t b, uint8_t a )
+// Set Fill Color (Packed Word: Two 16-Bit Pixels Or One 32-Bit Pixel, Also Used To Fill A Z Image)
+void rdp_set_fill_word( uint32_t color )
 {
-    uint32_t color;
-	
-    if( __bitdepth == BPP16 )
-    {
-        // 8 to 5 bit (RGB555)
-        r = r >> 3;
-        g = g >> 3;
-        b = b >> 3;
-        a = a >> 7;
-		
-        // Pack Color Twice For 16BPP Mode
-        color = r << 11 | g << 6 | b << 1 | a;
-        color = color | color << 16;
-    }
-    else
-        color = r << 24 | g << 16 | b << 8 | a;
-	
+    if( rdp_state_keep( RDP_STATE_FILL_COLOR, &rdp_state.fill_color, color ) ) return;
+    rdp_sync_before( RDP_HAZARD_PIPE );
+
     // Set Fill Color
     rdp_command( 0x37000000 );
     rdp_command( color );
 }
 
+// Set Fill Color (R,G,B,A)
+void rdp_set_fill_color( uint8_t r, uint8_t g, uint8_t b, uint8_t a )
+{
+    rdp_set_fill_word( rdp_fill_color_word( r, g, b, a ) );
+}
+
 // Set Fog Color (R,G,B,A)
 void rdp_set_fog_color( uint8_t r, uint8_t g, uint8_t b, uint8_t a )
 {
+    uint32_t color = r << 24 | g << 16 | b << 8 | a;
+    if( rdp_state_keep( RDP_STATE_FOG_COLOR, &rdp_state.fog_color, color ) ) return;
+    rdp_sync_before( RDP_HAZARD_PIPE );
+
     rdp_command( 0x38000000 );
-    rdp_command( r << 24 | g << 16 | b << 8 | a );
+    rdp_command( color );
 }
 
 // Set Blend Color (R,G,B,A)
 void rdp_set_blend_color( uint8_t r, uint8_t g, uint8_t b, uint8_t a )
 {
+    uint32_t color = r << 24 | g << 16 | b << 8 | a;
+    if( rdp_state_keep( RDP_STATE_BLEND_COLOR, &rdp_state.blend_color, color ) ) return;
+    rdp_sync_before( RDP_HAZARD_PIPE );
+
     rdp_command( 0x39000000 );
-    rdp_command( r << 24 | g << 16 | b << 8 | a );
+    rdp_command( color );
 }
 
 // Set Primitive Color (R,G,B,A)
 void rdp_set_prim_color( uint8_t r, uint8_t g, uint8_t b, uint8_t a )
 {
+    uint32_t color = r << 24 | g << 16 | b << 8 | a;
+    if( rdp_state_keep( RDP_STATE_PRIM_COLOR, &rdp_state.prim_color, color ) ) return;
+    rdp_sync_before( RDP_HAZARD_PIPE );
+
     rdp_command( 0x3A000000 );
-    rdp_command( r << 24 | g << 16 | b << 8 | a );
+    rdp_command( color );
 }
 
 // Set Environment Color (R,G,B,A)
 void rdp_set_env_color( uint8_t r, uint8_t g, uint8_t b, uint8_t a )
 {
+    uint32_t color = r << 24 | g << 16 | b << 8 | a;
+    if( rdp_state_keep( RDP_STATE_ENV_COLOR, &rdp_state.env_color, color ) ) return;
+    rdp_sync_before( RDP_HAZARD_PIPE );
+
     rdp_command( 0x3B000000 );
-    rdp_command( r << 24 | g << 16 | b << 8 | a );
+    rdp_command( color );
 }
 
 // Set Combine Mode
 void rdp_set_combine_mode( uint8_t sub_a_r0, uint8_t mul_r0, uint8_t sub_a_a0, uint8_t mul_a0, uint8_t sub_a_r1, uint8_t mul_r1, uint8_t sub_b_r0, uint8_t sub_b_r1, uint8_t sub_a_a1, uint8_t mul_a1, uint8_t add_r0, uint8_t sub_b_a0, uint8_t add_a0, uint8_t add_r1, uint8_t sub_b_a1, uint8_t add_a1 )
 {
-    rdp_command( 0x3C000000 | sub_a_r0 << 20 | mul_r0 << 15 | sub_a_a0 << 12 | mul_a0 << 9 | sub_a_r1 << 5 | mul_r1 );
-    rdp_command( sub_b_r0 << 28 | sub_b_r1 << 24 | sub_a_a1 << 21 | mul_a1 << 18 | add_r0 << 15 | sub_b_a0 << 12 | add_a0 << 9 | add_r1 << 6 | sub_b_a1 << 3 | add_a1);
+    uint32_t mode_hi = 0x3C000000 | sub_a_r0 << 20 | mul_r0 << 15 | sub_a_a0 << 12 | mul_a0 << 9 | sub_a_r1 << 5 | mul_r1;
+    uint32_t mode_lo = sub_b_r0 << 28 | sub_b_r1 << 24 | sub_a_a1 << 21 | mul_a1 << 18 | add_r0 << 15 | sub_b_a0 << 12 | add_a0 << 9 | add_r1 << 6 | sub_b_a1 << 3 | add_a1;
+    if( rdp_state_keep( RDP_STATE_COMBINE_MODE, &rdp_state.combine_mode, (uint64_t)mode_hi << 32 | mode_lo ) ) return;
+    rdp_sync_before( RDP_HAZARD_PIPE );
+
+    rdp_command( mode_hi );
+    rdp_command( mode_lo );
 }
 
 // Set Texture Image
@@ -389,6 +1019,8 @@ void rdp_set_texture_image( uint8_t format, uint8_t size, uint16_t width, uint32
 // Set Z Image
 void rdp_set_z_image( uint32_t address )
 {
+    rdp_sync_before( RDP_HAZARD_PIPE );
+
     rdp_command( 0x3E000000 );
     rdp_command( address );
 }
@@ -396,73 +1028,253 @@ void rdp_set_z_image( uint32_t address )
 // Set Color Image
 void rdp_set_color_image( uint8_t format, uint8_t size, uint16_t width, uint32_t address )
 {
+    rdp_sync_before( RDP_HAZARD_PIPE );
+
     rdp_command( 0x3F000000 | format << 21 | size << 19 | (width - 1) );
     rdp_command( address );
 }
 
 /*** RDP FUNCTIONS ***/
 
-// Draw Fill Triangle (From 3 Unsorted X/Y Points, With Fill Color)
-void rdp_draw_fill_triangle( float x1, float y1, float x2, float y2, float x3, float y3 )
+// Triangle Setup Vertex Layout (Floats Per Vertex): Screen X,Y, Color R,G,B,A (0..255), Texel S,T, W & Z
+#define RDP_VTX_X 0
+#define RDP_VTX_Y 1
+#define RDP_VTX_R 2
+#define RDP_VTX_G 3
+#define RDP_VTX_B 4
+#define RDP_VTX_A 5
+#define RDP_VTX_S 6
+#define RDP_VTX_T 7
+#define RDP_VTX_W 8
+#define RDP_VTX_Z 9
+#define RDP_VTX_SIZE 10
+
+// Triangle Setup Template (From 3 Unsorted Vertices, Any Triangle Command 0x08..0x0F: Bit 2 Shade, Bit 1 Texture, Bit 0 Z-Buffer)
+// Always Inlined With A Constant Command, So Every rdp_draw_*_triangle Variant Compiles To Its Own Branch-Free Setup & Encoder
+// Attributes Are Planes Over The Triangle: One Reciprocal Of The Edge Cross Product Gives Every X/Y Gradient,
+// The Edge Gradient Steps Down The Major Edge (DaDe = DaDy + DaDx * DxHDy) & Values Start At The Top Vertex (XH, YH)
+static inline __attribute__((always_inline)) void rdp_draw_triangle_setup( uint8_t command, const float *p1, const float *p2, const float *p3 )
 {
-    float temp_x, temp_y;
+    const int shade = command & 0x04, texture = command & 0x02, zbuffer = command & 0x01;
+    const float *temp;
 
-    // Sort Vertices By Y Ascending To Find The Major, Mid & Low Edges
-    if( y1 > y2 ) { temp_x = x2, temp_y = y2; y2 = y1; y1 = temp_y; x2 = x1; x1 = temp_x; }
-    if( y2 > y3 ) { temp_x = x3, temp_y = y3; y3 = y2; y2 = temp_y; x3 = x2; x2 = temp_x; }
-    if( y1 > y2 ) { temp_x = x2, temp_y = y2; y2 = y1; y1 = temp_y; x2 = x1; x1 = temp_x; }
+    // Sort Vertices By Y Ascending To Find The Major, Mid & Low Edges (Attributes Travel With Their Vertex)
+    if( p1[RDP_VTX_Y] > p2[RDP_VTX_Y] ) { temp = p2; p2 = p1; p1 = temp; }
+    if( p2[RDP_VTX_Y] > p3[RDP_VTX_Y] ) { temp = p3; p3 = p2; p2 = temp; }
+    if( p1[RDP_VTX_Y] > p2[RDP_VTX_Y] ) { temp = p2; p2 = p1; p1 = temp; }
 
     // yh = y1, ym = y2, yl = y3
     // xh = x1, xm = x1, xl = x2
     // Calculate Inverse Slopes
-    float dxhdy = ( y3 == y1 ) ? 0 : ( ( x3 - x1 ) / ( y3 - y1 ) );
-    float dxmdy = ( y2 == y1 ) ? 0 : ( ( x2 - x1 ) / ( y2 - y1 ) );
+    float x1 = p1[RDP_VTX_X], y1 = p1[RDP_VTX_Y], x2 = p2[RDP_VTX_X], y2 = p2[RDP_VTX_Y], x3 = p3[RDP_VTX_X], y3 = p3[RDP_VTX_Y];
+    float hx = x3 - x1, hy = y3 - y1;
+    float mx = x2 - x1, my = y2 - y1;
+    float dxhdy = ( hy == 0 ) ? 0 : ( hx / hy );
+    float dxmdy = ( my == 0 ) ? 0 : ( mx / my );
     float dxldy = ( y3 == y2 ) ? 0 : ( ( x3 - x2 ) / ( y3 - y2 ) );
 
     // Determine Triangle Winding Left Major Flag
-    int Hdx = x3 - x1; int Hdy = y3 - y1;
-    int Mdx = x2 - x1; int Mdy = y2 - y1;
-    int r = Hdx * Mdy - Hdy * Mdx;
-    int lft = r < 0 ? 1 : 0;
+    float nz = hx * my - hy * mx;
+    int lft = nz < 0 ? 1 : 0;
+
+    // Attribute Gradients Of The Lanes This Command Uses: Each Plane Solved With The Shared Reciprocal (0 For A Degenerate Triangle)
+    const int first = shade ? RDP_VTX_R : ( texture ? RDP_VTX_S : RDP_VTX_Z );
+    const int last = zbuffer ? RDP_VTX_SIZE : ( texture ? RDP_VTX_Z : RDP_VTX_S );
+    float attr_factor = ( nz == 0 ) ? 0 : ( -1.0f / nz );
+    float dadx[RDP_VTX_SIZE], dady[RDP_VTX_SIZE], dade[RDP_VTX_SIZE];
+    for( int a = first; a < last; a++ ) {
+        float ma = p2[a] - p1[a], ha = p3[a] - p1[a];
+        dadx[a] = ( hy * ma - my * ha ) * attr_factor;
+        dady[a] = ( mx * ha - hx * ma ) * attr_factor;
+        dade[a] = dady[a] + dadx[a] * dxhdy;
+    }
+
+    // Command & Edge Coefficients, Then The Shade, Texture & Z-Buffer Blocks (One Reservation For The Whole Primitive)
+    const uint32_t count = 4 + ( shade ? 8 : 0 ) + ( texture ? 8 : 0 ) + ( zbuffer ? 2 : 0 );
+    rdp_sync_after( texture ? RDP_HAZARD_ALL : RDP_HAZARD_PIPE ); // Textured Triangles Also Use Tiles & TMEM
+
+    uint64_t *cmd = rdp_reserve( count );
+    cmd[0] = RDP_DWORD( (uint32_t)command << 24 | lft << 23 | (RDP_S11_2( y3 ) & 0x3FFF), (RDP_S11_2( y2 ) & 0x3FFF) << 16 | (RDP_S11_2( y1 ) & 0x3FFF) ); // Level 0, Tile 0
+    cmd[1] = RDP_DWORD( RDP_S15_16( x2 ), RDP_S15_16( dxldy ) );
+    cmd[2] = RDP_DWORD( RDP_S15_16( x1 ), RDP_S15_16( dxhdy ) );
+    cmd[3] = RDP_DWORD( RDP_S15_16( x1 ), RDP_S15_16( dxmdy ) );
+    cmd += 4;
+
+    if( shade ) {
+        rdp_attribute_block( cmd, &p1[RDP_VTX_R], &dadx[RDP_VTX_R], &dade[RDP_VTX_R], &dady[RDP_VTX_R] ); // R,G,B,A
+        cmd += 8;
+    }
+    if( texture ) { // Texels To S10.5
+        const float value[4] = { p1[RDP_VTX_S] * 32.0f, p1[RDP_VTX_T] * 32.0f, p1[RDP_VTX_W], 0 };
+        const float dx[4] = { dadx[RDP_VTX_S] * 32.0f, dadx[RDP_VTX_T] * 32.0f, dadx[RDP_VTX_W], 0 };
+        const float de[4] = { dade[RDP_VTX_S] * 32.0f, dade[RDP_VTX_T] * 32.0f, dade[RDP_VTX_W], 0 };
+        const float dy[4] = { dady[RDP_VTX_S] * 32.0f, dady[RDP_VTX_T] * 32.0f, dady[RDP_VTX_W], 0 };
+        rdp_attribute_block( cmd, value, dx, de, dy );
+        cmd += 8;
+    }
+    if( zbuffer ) {
+        cmd[0] = RDP_DWORD( RDP_S15_16( p1[RDP_VTX_Z] ), RDP_S15_16( dadx[RDP_VTX_Z] ) );
+        cmd[1] = RDP_DWORD( RDP_S15_16( dade[RDP_VTX_Z] ), RDP_S15_16( dady[RDP_VTX_Z] ) );
+    }
+    rdp_commit( count );
+}
 
-    // Command & Edge Coefficients
-    rdp_fill_triangle( lft, 0, 0, y3, y2, y1, x2, dxldy, x1, dxhdy, x1, dxmdy ); // lft, Level, Tile, YL, YM, YH, XL,DxLDy, XH,DxHDy, XM, DxMDy
+// Draw Fill Triangle (From 3 Unsorted X/Y Points, With Fill Color)
+void rdp_draw_fill_triangle( float x1, float y1, float x2, float y2, float x3, float y3 )
+{
+    float v[3][RDP_VTX_SIZE];
+    v[0][RDP_VTX_X] = x1; v[0][RDP_VTX_Y] = y1;
+    v[1][RDP_VTX_X] = x2; v[1][RDP_VTX_Y] = y2;
+    v[2][RDP_VTX_X] = x3; v[2][RDP_VTX_Y] = y3;
+    rdp_draw_triangle_setup( 0x08, v[0], v[1], v[2] ); // Fill Triangle
 }
 
 // Draw Fill Z-Buffer Triangle (From 3 Unsorted X/Y/Z Points, With Fill Color)
 void rdp_draw_fill_zbuffer_triangle( float x1, float y1, float z1, float x2, float y2, float z2, float x3, float y3, float z3 )
 {
-    float temp_x, temp_y, temp_z;
+    float v[3][RDP_VTX_SIZE];
+    v[0][RDP_VTX_X] = x1; v[0][RDP_VTX_Y] = y1;
+    v[1][RDP_VTX_X] = x2; v[1][RDP_VTX_Y] = y2;
+    v[2][RDP_VTX_X] = x3; v[2][RDP_VTX_Y] = y3;
+    v[0][RDP_VTX_Z] = z1; v[1][RDP_VTX_Z] = z2; v[2][RDP_VTX_Z] = z3;
+    rdp_draw_triangle_setup( 0x09, v[0], v[1], v[2] ); // Fill Z-Buffer Triangle
+}
+
+// Draw Texture Triangle (From 3 Unsorted X/Y Points With S/T Texel Coordinates & W, Tile 0, Affine Unless W Comes From rdp_draw_texture_triangle_persp)
+void rdp_draw_texture_triangle( float x1, float y1, float s1, float t1, float w1, float x2, float y2, float s2, float t2, float w2, float x3, float y3, float s3, float t3, float w3 )
+{
+    float v[3][RDP_VTX_SIZE];
+    v[0][RDP_VTX_X] = x1; v[0][RDP_VTX_Y] = y1;
+    v[1][RDP_VTX_X] = x2; v[1][RDP_VTX_Y] = y2;
+    v[2][RDP_VTX_X] = x3; v[2][RDP_VTX_Y] = y3;
+    v[0][RDP_VTX_S] = s1; v[0][RDP_VTX_T] = t1; v[0][RDP_VTX_W] = w1;
+    v[1][RDP_VTX_S] = s2; v[1][RDP_VTX_T] = t2; v[1][RDP_VTX_W] = w2;
+    v[2][RDP_VTX_S] = s3; v[2][RDP_VTX_T] = t3; v[2][RDP_VTX_W] = w3;
+    rdp_draw_triangle_setup( 0x0A, v[0], v[1], v[2] ); // Texture Triangle
+}
+
+// Draw Texture Z-Buffer Triangle (From 3 Unsorted X/Y/Z Points With S/T Texel Coordinates & W, Tile 0)
+void rdp_draw_texture_zbuffer_triangle( float x1, float y1, float z1, float s1, float t1, float w1, float x2, float y2, float z2, float s2, float t2, float w2, float x3, float y3, float z3, float s3, float t3, float w3 )
+{
+    float v[3][RDP_VTX_SIZE];
+    v[0][RDP_VTX_X] = x1; v[0][RDP_VTX_Y] = y1;
+    v[1][RDP_VTX_X] = x2; v[1][RDP_VTX_Y] = y2;
+    v[2][RDP_VTX_X] = x3; v[2][RDP_VTX_Y] = y3;
+    v[0][RDP_VTX_S] = s1; v[0][RDP_VTX_T] = t1; v[0][RDP_VTX_W] = w1; v[0][RDP_VTX_Z] = z1;
+    v[1][RDP_VTX_S] = s2; v[1][RDP_VTX_T] = t2; v[1][RDP_VTX_W] = w2; v[1][RDP_VTX_Z] = z2;
+    v[2][RDP_VTX_S] = s3; v[2][RDP_VTX_T] = t3; v[2][RDP_VTX_W] = w3; v[2][RDP_VTX_Z] = z3;
+    rdp_draw_triangle_setup( 0x0B, v[0], v[1], v[2] ); // Texture Z-Buffer Triangle
+}
+
+// Draw Shade Triangle (From 3 Unsorted X/Y Points With R/G/B/A Vertex Colors 0..255, Gouraud Shaded)
+void rdp_draw_shade_triangle( float x1, float y1, float r1, float g1, float b1, float a1, float x2, float y2, float r2, float g2, float b2, float a2, float x3, float y3, float r3, float g3, float b3, float a3 )
+{
+    float v[3][RDP_VTX_SIZE];
+    v[0][RDP_VTX_X] = x1; v[0][RDP_VTX_Y] = y1; v[0][RDP_VTX_R] = r1; v[0][RDP_VTX_G] = g1; v[0][RDP_VTX_B] = b1; v[0][RDP_VTX_A] = a1;
+    v[1][RDP_VTX_X] = x2; v[1][RDP_VTX_Y] = y2; v[1][RDP_VTX_R] = r2; v[1][RDP_VTX_G] = g2; v[1][RDP_VTX_B] = b2; v[1][RDP_VTX_A] = a2;
+    v[2][RDP_VTX_X] = x3; v[2][RDP_VTX_Y] = y3; v[2][RDP_VTX_R] = r3; v[2][RDP_VTX_G] = g3; v[2][RDP_VTX_B] = b3; v[2][RDP_VTX_A] = a3;
+    rdp_draw_triangle_setup( 0x0C, v[0], v[1], v[2] ); // Shade Triangle
+}
+
+// Draw Shade Z-Buffer Triangle (From 3 Unsorted X/Y/Z Points With R/G/B/A Vertex Colors 0..255, Gouraud Shaded)
+void rdp_draw_shade_zbuffer_triangle( float x1, float y1, float z1, float r1, float g1, float b1, float a1, float x2, float y2, float z2, float r2, float g2, float b2, float a2, float x3, float y3, float z3, float r3, float g3, float b3, float a3 )
+{
+    float v[3][RDP_VTX_SIZE];
+    v[0][RDP_VTX_X] = x1; v[0][RDP_VTX_Y] = y1; v[0][RDP_VTX_R] = r1; v[0][RDP_VTX_G] = g1; v[0][RDP_VTX_B] = b1; v[0][RDP_VTX_A] = a1;
+    v[1][RDP_VTX_X] = x2; v[1][RDP_VTX_Y] = y2; v[1][RDP_VTX_R] = r2; v[1][RDP_VTX_G] = g2; v[1][RDP_VTX_B] = b2; v[1][RDP_VTX_A] = a2;
+    v[2][RDP_VTX_X] = x3; v[2][RDP_VTX_Y] = y3; v[2][RDP_VTX_R] = r3; v[2][RDP_VTX_G] = g3; v[2][RDP_VTX_B] = b3; v[2][RDP_VTX_A] = a3;
+    v[0][RDP_VTX_Z] = z1; v[1][RDP_VTX_Z] = z2; v[2][RDP_VTX_Z] = z3;
+    rdp_draw_triangle_setup( 0x0D, v[0], v[1], v[2] ); // Shade Z-Buffer Triangle
+}
+
+// Draw Shade Texture Triangle (From 3 Unsorted X/Y Points With R/G/B/A Vertex Colors 0..255, S/T Texel Coordinates & W, Tile 0)
+void rdp_draw_shade_texture_triangle( float x1, float y1, float r1, float g1, float b1, float a1, float s1, float t1, float w1, float x2, float y2, float r2, float g2, float b2, float a2, float s2, float t2, float w2, float x3, float y3, float r3, float g3, float b3, float a3, float s3, float t3, float w3 )
+{
+    float v[3][RDP_VTX_SIZE];
+    v[0][RDP_VTX_X] = x1; v[0][RDP_VTX_Y] = y1; v[0][RDP_VTX_R] = r1; v[0][RDP_VTX_G] = g1; v[0][RDP_VTX_B] = b1; v[0][RDP_VTX_A] = a1; v[0][RDP_VTX_S] = s1; v[0][RDP_VTX_T] = t1; v[0][RDP_VTX_W] = w1;
+    v[1][RDP_VTX_X] = x2; v[1][RDP_VTX_Y] = y2; v[1][RDP_VTX_R] = r2; v[1][RDP_VTX_G] = g2; v[1][RDP_VTX_B] = b2; v[1][RDP_VTX_A] = a2; v[1][RDP_VTX_S] = s2; v[1][RDP_VTX_T] = t2; v[1][RDP_VTX_W] = w2;
+    v[2][RDP_VTX_X] = x3; v[2][RDP_VTX_Y] = y3; v[2][RDP_VTX_R] = r3; v[2][RDP_VTX_G] = g3; v[2][RDP_VTX_B] = b3; v[2][RDP_VTX_A] = a3; v[2][RDP_VTX_S] = s3; v[2][RDP_VTX_T] = t3; v[2][RDP_VTX_W] = w3;
+    rdp_draw_triangle_setup( 0x0E, v[0], v[1], v[2] ); // Shade Texture Triangle
+}
+
+// Draw Shade Texture Z-Buffer Triangle (From 3 Unsorted X/Y/Z Points With R/G/B/A Vertex Colors 0..255, S/T Texel Coordinates & W, Tile 0)
+void rdp_draw_shade_texture_zbuffer_triangle( float x1, float y1, float z1, float r1, float g1, float b1, float a1, float s1, float t1, float w1, float x2, float y2, float z2, float r2, float g2, float b2, float a2, float s2, float t2, float w2, float x3, float y3, float z3, float r3, float g3, float b3, float a3, float s3, float t3, float w3 )
+{
+    float v[3][RDP_VTX_SIZE];
+    v[0][RDP_VTX_X] = x1; v[0][RDP_VTX_Y] = y1; v[0][RDP_VTX_R] = r1; v[0][RDP_VTX_G] = g1; v[0][RDP_VTX_B] = b1; v[0][RDP_VTX_A] = a1; v[0][RDP_VTX_S] = s1; v[0][RDP_VTX_T] = t1; v[0][RDP_VTX_W] = w1;
+    v[1][RDP_VTX_X] = x2; v[1][RDP_VTX_Y] = y2; v[1][RDP_VTX_R] = r2; v[1][RDP_VTX_G] = g2; v[1][RDP_VTX_B] = b2; v[1][RDP_VTX_A] = a2; v[1][RDP_VTX_S] = s2; v[1][RDP_VTX_T] = t2; v[1][RDP_VTX_W] = w2;
+    v[2][RDP_VTX_X] = x3; v[2][RDP_VTX_Y] = y3; v[2][RDP_VTX_R] = r3; v[2][RDP_VTX_G] = g3; v[2][RDP_VTX_B] = b3; v[2][RDP_VTX_A] = a3; v[2][RDP_VTX_S] = s3; v[2][RDP_VTX_T] = t3; v[2][RDP_VTX_W] = w3;
+    v[0][RDP_VTX_Z] = z1; v[1][RDP_VTX_Z] = z2; v[2][RDP_VTX_Z] = z3;
+    rdp_draw_triangle_setup( 0x0F, v[0], v[1], v[2] ); // Shade Texture Z-Buffer Triangle
+}
+
+// Draw Perspective Correct Texture Triangle (From 3 Unsorted X/Y Points With S/T Texel Coordinates & 1/W, Needs PERSP_TEX_EN)
+// The RDP Divides S & T By W Per Pixel, So The Planes Set Up Are S/W, T/W & 1/W (Linear In Screen Space, Unlike S & T)
+// 1/W Is Normalised To The Nearest Vertex (W = 0x7FFF There), Keeping The Full Divider Precision At Any Depth
+void rdp_draw_texture_triangle_persp( float x1, float y1, float s1, float t1, float inv_w1, float x2, float y2, float s2, float t2, float inv_w2, float x3, float y3, float s3, float t3, float inv_w3 )
+{
+    float max_w = ( inv_w1 > inv_w2 ) ? inv_w1 : inv_w2;
+    if( inv_w3 > max_w ) max_w = inv_w3;
+    float w_factor = 1.0f / max_w; // One Reciprocal Per Triangle (Clipped Triangles Have 1/W > 0)
+
+    float w1 = inv_w1 * w_factor, w2 = inv_w2 * w_factor, w3 = inv_w3 * w_factor;
+    rdp_draw_texture_triangle( x1, y1, s1 * w1, t1 * w1, w1 * 32767.0f, x2, y2, s2 * w2, t2 * w2, w2 * 32767.0f, x3, y3, s3 * w3, t3 * w3, w3 * 32767.0f );
+}
+
+// Draw Perspective Correct Texture Z-Buffer Triangle (From 3 Unsorted X/Y/Z Points With S/T Texel Coordinates & 1/W, Needs PERSP_TEX_EN)
+// Same Planes As rdp_draw_texture_triangle_persp, Plus The Depth (Z Must Also Be Linear In Screen Space, E.g. From 1/W)
+void rdp_draw_texture_zbuffer_triangle_persp( float x1, float y1, float z1, float s1, float t1, float inv_w1, float x2, float y2, float z2, float s2, float t2, float inv_w2, float x3, float y3, float z3, float s3, float t3, float inv_w3 )
+{
+    float max_w = ( inv_w1 > inv_w2 ) ? inv_w1 : inv_w2;
+    if( inv_w3 > max_w ) max_w = inv_w3;
+    float w_factor = 1.0f / max_w;
+
+    float w1 = inv_w1 * w_factor, w2 = inv_w2 * w_factor, w3 = inv_w3 * w_factor;
+    rdp_draw_texture_zbuffer_triangle( x1, y1, z1, s1 * w1, t1 * w1, w1 * 32767.0f, x2, y2, z2, s2 * w2, t2 * w2, w2 * 32767.0f, x3, y3, z3, s3 * w3, t3 * w3, w3 * 32767.0f );
+}
+
+// Inverse Edge Slope In S15.16 From S11.2 Deltas (0 For A Horizontal Edge, Truncated Toward Zero)
+static inline int32_t rdp_edge_slope_fx( int32_t dx, int32_t dy )
+{
+    if( dy == 0 ) return 0;
+    if( dx >= -32768 && dx < 32768 ) return (dx * 65536) / dy; // Fits 32 Bits: Single Divide
+
+    // Wide Edge: Split Into Whole & Fraction So Nothing Needs 64-Bit Division (No libgcc In The ROM Link)
+    // |dy| Fits S11.2 (< 16384), So The Remainder Scaled By 65536 Stays Within 32 Bits
+    return (dx / dy) * 65536 + ((dx % dy) * 65536) / dy;
+}
+
+// Draw Triangle Edges (From 3 Unsorted S11.2 X/Y Points, Integer Setup, Any Triangle Command 0x08..0x0F)
+void rdp_draw_triangle_fx( uint8_t command, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3 )
+{
+    int32_t temp_x, temp_y;
 
     // Sort Vertices By Y Ascending To Find The Major, Mid & Low Edges
-    if( y1 > y2 ) { temp_x = x2, temp_y = y2, temp_z = z2; z2 = z1; z1 = temp_z; y2 = y1; y1 = temp_y; x2 = x1; x1 = temp_x; }
-    if( y2 > y3 ) { temp_x = x3, temp_y = y3, temp_z = z3; z3 = z2; z2 = temp_z; y3 = y2; y2 = temp_y; x3 = x2; x2 = temp_x; }
-    if( y1 > y2 ) { temp_x = x2, temp_y = y2, temp_z = z2; z2 = z1; z1 = temp_z; y2 = y1; y1 = temp_y; x2 = x1; x1 = temp_x; }
+    if( y1 > y2 ) { temp_x = x2, temp_y = y2; y2 = y1; y1 = temp_y; x2 = x1; x1 = temp_x; }
+    if( y2 > y3 ) { temp_x = x3, temp_y = y3; y3 = y2; y2 = temp_y; x3 = x2; x2 = temp_x; }
+    if( y1 > y2 ) { temp_x = x2, temp_y = y2; y2 = y1; y1 = temp_y; x2 = x1; x1 = temp_x; }
 
     // yh = y1, ym = y2, yl = y3
     // xh = x1, xm = x1, xl = x2
-    // Calculate Inverse Slopes
-    float dxhdy = ( y3 == y1 ) ? 0 : ( ( x3 - x1 ) / ( y3 - y1 ) );
-    float dxmdy = ( y2 == y1 ) ? 0 : ( ( x2 - x1 ) / ( y2 - y1 ) );
-    float dxldy = ( y3 == y2 ) ? 0 : ( ( x3 - x2 ) / ( y3 - y2 ) );
+    // Calculate Inverse Slopes (S11.2 / S11.2 = Unitless, Scaled To S15.16)
+    int32_t dxhdy = rdp_edge_slope_fx( x3 - x1, y3 - y1 );
+    int32_t dxmdy = rdp_edge_slope_fx( x2 - x1, y2 - y1 );
+    int32_t dxldy = rdp_edge_slope_fx( x3 - x2, y3 - y2 );
 
-    // Determine Triangle Winding Left Major Flag
-    int Hdx = x3 - x1; int Hdy = y3 - y1;
-    int Mdx = x2 - x1; int Mdy = y2 - y1;
-    int r = Hdx * Mdy - Hdy * Mdx;
+    // Determine Triangle Winding Left Major Flag (Cross Product In Quarter Pixels)
+    int32_t Hdx = x3 - x1; int32_t Hdy = y3 - y1;
+    int32_t Mdx = x2 - x1; int32_t Mdy = y2 - y1;
+    int32_t r = Hdx * Mdy - Hdy * Mdx;
     int lft = r < 0 ? 1 : 0;
 
-    // Command & Edge Coefficients
-    rdp_fill_zbuffer_triangle( lft, 0, 0, y3, y2, y1, x2, dxldy, x1, dxhdy, x1, dxmdy ); // lft, Level, Tile, YL, YM, YH, XL,DxLDy, XH,DxHDy, XM, DxMDy
-
-    // zh = z1, zm = z2, zl = z3
-    // Calculate Inverse Slopes
-    float dzde = ( y3 == y1 ) ? 0 : ( ( z3 - z1 ) / ( y3 - y1 ) );
-    float dzdx = ( x2 == x1 ) ? 0 : ( ( z2 - z1 ) / ( x2 - x1 ) );
-    float dzdy = ( y2 == y1 ) ? 0 : ( ( z2 - z1 ) / ( y2 - y1 ) );
+    // Command & Edge Coefficients (S11.2 X To S15.16)
+    rdp_triangle_fx( command, lft, 0, 0, y3, y2, y1, x2 * 16384, dxldy, x1 * 16384, dxhdy, x1 * 16384, dxmdy ); // Command, lft, Level, Tile, YL, YM, YH, XL,DxLDy, XH,DxHDy, XM, DxMDy
+}
 
-    // Z-Buffer Coefficiants
-    rdp_zbuffer_coefficients( z1, dzdx, dzde, dzdy ); // Z, DzDx, DzDe, DzDy
+// Draw Fill Triangle (From 3 Unsorted S11.2 X/Y Points, With Fill Color, Integer Setup)
+void rdp_draw_fill_triangle_fx( int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3 )
+{
+    rdp_draw_triangle_fx( 0x08, x1, y1, x2, y2, x3, y3 ); // Fill Triangle
 }
 
 /*** RDP EFFECTS ***/
@@ -470,7 +1282,9 @@ void rdp_draw_fill_zbuffer_triangle( float x1, float y1, float z1, float x2, flo
 // Additive Blending
 void rdp_additive( void )
 {	
-    // Set Combine Mode
+    // Set Combine Mode (Raw, Not Shadowed)
+    rdp_state.valid &= ~RDP_STATE_COMBINE_MODE;
+    rdp_sync_before( RDP_HAZARD_PIPE );
     rdp_command( 0x3C000061 );
     rdp_command( 0x082C017F );			
 }
@@ -479,7 +1293,9 @@ void rdp_additive( void )
    Prim color RGB from 0 (normal) to 255 (white) */
 void rdp_intensify( uint8_t enable_alpha )
 {	
-    // Set Combine Mode
+    // Set Combine Mode (Raw, Not Shadowed)
+    rdp_state.valid &= ~RDP_STATE_COMBINE_MODE;
+    rdp_sync_before( RDP_HAZARD_PIPE );
     rdp_command( 0x3C0000C1 );
     rdp_command( (enable_alpha == 0) ? 0x032C00C0 : 0x032C00FF );	
 }
@@ -487,7 +1303,9 @@ void rdp_intensify( uint8_t enable_alpha )
 // Unique Color (sprite silouette)
 void rdp_color( uint8_t enable_alpha )
 {	
-    // Set Combine Mode
+    // Set Combine Mode (Raw, Not Shadowed)
+    rdp_state.valid &= ~RDP_STATE_COMBINE_MODE;
+    rdp_sync_before( RDP_HAZARD_PIPE );
     rdp_command( 0x3C000063 );
     rdp_command( (enable_alpha == 0) ? 0x082C01C0 : 0x082C01FF );		
 }
@@ -495,7 +1313,9 @@ void rdp_color( uint8_t enable_alpha )
 // TV Noise Effects (0 disable, 1 partial, 2 complete)
 void rdp_noise( uint8_t type, uint8_t enable_alpha )
 {	
-    // Set Combine Mode
+    // Set Combine Mode (Raw, Not Shadowed)
+    rdp_state.valid &= ~RDP_STATE_COMBINE_MODE;
+    rdp_sync_before( RDP_HAZARD_PIPE );
     if (type>0)
         rdp_command( (type == 1) ? 0x3C0000E1 : 0x3C0000E3 );
     else
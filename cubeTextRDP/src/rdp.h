@@ -34,6 +34,15 @@
 #define PIXEL_ADV_F 0x0F000 // VI Status/Control: Pixel Advance F (Bit 12..15)
 #define DITHER_FILTER_EN 0x10000 // VI Status/Control: Dither Filter Enable (Used With 16BPP Display) (Bit 16)
 
+#define DPC_START 0xA4100000   // DP Command: DMA Start Address Register (Physical Address Of The RDP DRAM List)
+#define DPC_END 0xA4100004     // DP Command: DMA End Address Register (Writing It Starts The Transfer)
+#define DPC_CURRENT 0xA4100008 // DP Command: DMA Current Address Register (Read Only)
+#define DPC_STATUS 0xA410000C  // DP Command: Status Register
+#define DPC_STATUS_CMD_BUSY 0x00040    // DP Status: Command Buffer Busy (Bit 6)
+#define DPC_STATUS_DMA_BUSY 0x00100    // DP Status: DMA Busy (Bit 8)
+#define DPC_STATUS_END_VALID 0x00200   // DP Status: End Address Pending (Bit 9)
+#define DPC_STATUS_START_VALID 0x00400 // DP Status: Start Address Pending (Bit 10)
+
 // No_Op: No Effect On RDP Command Execution, Useful For Padding Command Buffers
 
 // Fill_Triangle: lft,level,tile,yl,ym,yh, xl,xlf,dxldy,dxldyf, xh,xhf,dxhdy,dxhdyf, xm,xmf,dxmdy,dxmdyf
@@ -436,4 +445,4 @@
 // Word: Base Address (Top Left Corner) Of Image In DRAM, In Bytes
 
 // Set_Color_Image: Set The Color Image
-// Word: Image Data Format, Size Of Pixel/Texel Color Element, Width Of Image In Pixels: Image Width=Width+1, Base Address (Top Left Corner) Of Image In DRAM
\ No newline at end of file
+// Word: Image Data Format, Size Of Pixel/Texel Color Element, Width Of Image In Pixels: Image Width=Width+1, Base Address (Top Left Corner) Of Image In DRAM
\ No newline at end of file
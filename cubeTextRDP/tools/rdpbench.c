@@ -0,0 +1,564 @@
+// RDP & 3D Host Benchmarks
+//
+// Builds the ROM sources with the host command sink (RDP_SINK_HOST) & times the command
+// emitters & 3D paths against the versions they replaced (kept here as local references).
+// Each section prints the best of BENCH_REPEATS runs; host timings only rank the paths,
+// the VR4300 spends its time differently (uncached stores, slow FPU divides).
+//
+// Build & Run: make bench (or: gcc -std=c99 -DRDP_SINK=RDP_SINK_HOST -O2 -o rdpbench tools/rdpbench.c -lm)
+#define _POSIX_C_SOURCE 199309L // clock_gettime
+#include <math.h>
+#include <time.h>
+#include "../src/rdp.c"
+#include "../src/3d.c"
+#include "../src/3dscene.c"
+
+#if RDP_SINK != RDP_SINK_HOST
+#error "rdpbench needs the host command sink: build with -DRDP_SINK=RDP_SINK_HOST"
+#endif
+
+#define BENCH_REPEATS 5 // Runs Per Measurement (The Fastest Is Printed)
+#define BENCH_TRIANGLES 200000 // Random Screen Triangles Per Triangle Setup Run
+#define BENCH_VERTICES 100000 // Random Model Vertices Per Vertex Transform Run
+#define BENCH_PROJECT 1000000 // Random Model Vertices Per Projection Run
+#define BENCH_ROTATIONS 1000000 // Random X,Y,Z Angles Per Rotation Run
+#define BENCH_INSTANCES 500 // Random Cube Instances Per Scene
+#define BENCH_DENSE 35 // Overlapping Cubes In The Dense Scene (7x5 Grid)
+
+/*** TIMING ***/
+
+// Monotonic Time In Nanoseconds
+static double bench_now( void )
+{
+  struct timespec t;
+  clock_gettime( CLOCK_MONOTONIC, &t );
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+// Fastest Of BENCH_REPEATS Runs Of "run( count )", In Nanoseconds Per Item
+static double bench_best( void (*run)( uint32_t count ), uint32_t count )
+{
+  double best = 1e30;
+  for( int r = 0; r < BENCH_REPEATS; r++ ) {
+    double start = bench_now();
+    run( count );
+    double time = (bench_now() - start) / count;
+    if( time < best ) best = time;
+  }
+  return best;
+}
+
+// Fixed Seed Pseudo Random Numbers (Same Sequence On Every Host)
+static uint32_t bench_seed = 1;
+static uint32_t bench_random( void )
+{
+  bench_seed = bench_seed * 1103515245 + 12345;
+  return bench_seed >> 8;
+}
+
+// Start An Empty Command List At Offset 0 (No Pending Syncs, No Shadowed State)
+static void bench_list_reset( void )
+{
+  memory_pos = 0;
+  rdp_sync_pending = 0;
+  rdp_state_invalidate();
+}
+
+/*** COMMAND EMISSION (WORD AT A TIME VS RESERVE/COMMIT) ***/
+
+// Reference: The Original Word At A Time Emitter (Store, Advance & Wrap Per Word)
+static void bench_word( uint32_t data )
+{
+  *rdp_sink_word( memory_pos ) = data;
+  memory_pos += 4;
+  memory_pos = memory_pos % 131072;
+}
+
+static void bench_fill_triangle_words( uint8_t lft, float yl, float ym, float yh, float xl, float dxldy, float xh, float dxhdy, float xm, float dxmdy )
+{
+  bench_word( 0x08000000 | lft << 23 | ((int)(yl * 4.0) & 0x3FFF) );
+  bench_word( ((int)(ym * 4.0) & 0x3FFF) << 16 | ((int)(yh * 4.0) & 0x3FFF) );
+  bench_word( (int)(xl * 65536.0) );
+  bench_word( (int)(dxldy * 65536.0) );
+  bench_word( (int)(xh * 65536.0) );
+  bench_word( (int)(dxhdy * 65536.0) );
+  bench_word( (int)(xm * 65536.0) );
+  bench_word( (int)(dxmdy * 65536.0) );
+}
+
+// Reference Coefficient Block: 4 Lanes Of Value, DxDx, DxDe & DxDy (Integer Words, Then Fraction Words)
+static void bench_coefficient_words( const float v[4], const float dx[4], const float de[4], const float dy[4] )
+{
+  bench_word( (int)(v[0]) << 16 | ((int)(v[1]) & 0xFFFF) );
+  bench_word( (int)(v[2]) << 16 | ((int)(v[3]) & 0xFFFF) );
+  bench_word( (int)(dx[0]) << 16 | ((int)(dx[1]) & 0xFFFF) );
+  bench_word( (int)(dx[2]) << 16 | ((int)(dx[3]) & 0xFFFF) );
+  bench_word( (int)(v[0] * 65536.0) << 16 | ((int)(v[1] * 65536.0) & 0xFFFF) );
+  bench_word( (int)(v[2] * 65536.0) << 16 | ((int)(v[3] * 65536.0) & 0xFFFF) );
+  bench_word( (int)(dx[0] * 65536.0) << 16 | ((int)(dx[1] * 65536.0) & 0xFFFF) );
+  bench_word( (int)(dx[2] * 65536.0) << 16 | ((int)(dx[3] * 65536.0) & 0xFFFF) );
+  bench_word( (int)(de[0]) << 16 | ((int)(de[1]) & 0xFFFF) );
+  bench_word( (int)(de[2]) << 16 | ((int)(de[3]) & 0xFFFF) );
+  bench_word( (int)(dy[0]) << 16 | ((int)(dy[1]) & 0xFFFF) );
+  bench_word( (int)(dy[2]) << 16 | ((int)(dy[3]) & 0xFFFF) );
+  bench_word( (int)(de[0] * 65536.0) << 16 | ((int)(de[1] * 65536.0) & 0xFFFF) );
+  bench_word( (int)(de[2] * 65536.0) << 16 | ((int)(de[3] * 65536.0) & 0xFFFF) );
+  bench_word( (int)(dy[0] * 65536.0) << 16 | ((int)(dy[1] * 65536.0) & 0xFFFF) );
+  bench_word( (int)(dy[2] * 65536.0) << 16 | ((int)(dy[3] * 65536.0) & 0xFFFF) );
+}
+
+// Primitive Set: Other Modes, Fill Triangle Edges, Texture & Shade Coefficients (42 Words)
+static void bench_emit_words( uint32_t count )
+{
+  const float s[4] = { 1, 2, 3, 0 }, sdx[4] = { 4, 5, 6, 0 }, sde[4] = { 7, 8, 9, 0 }, sdy[4] = { 10, 11, 12.5f, 0 };
+  const float c[4] = { 255, 128, 64, 255 }, cdx[4] = { 1.5f, 2, 3, 4 }, cde[4] = { 5, 6, 7, 8 }, cdy[4] = { 9, 10, 11, 12 };
+  for( uint32_t i = 0; i < count; i++ ) {
+    memory_pos = 0;
+    bench_word( 0x2F000000 | (uint32_t)(i & 1) );
+    bench_word( 0 );
+    bench_fill_triangle_words( i & 1, 100.25f, 50.5f, 10, 30 + (i & 7), 0.5f, 20, -1.25f, 20, 2 );
+    bench_coefficient_words( s, sdx, sde, sdy );
+    bench_coefficient_words( c, cdx, cde, cdy );
+  }
+}
+
+static void bench_emit_reserve( uint32_t count )
+{
+  for( uint32_t i = 0; i < count; i++ ) {
+    bench_list_reset();
+    rdp_set_other_modes( (uint64_t)(i & 1) << 32 );
+    rdp_fill_triangle( i & 1, 0, 0, 100.25f, 50.5f, 10, 30 + (i & 7), 0.5f, 20, -1.25f, 20, 2 );
+    rdp_texture_coefficients( 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12.5f );
+    rdp_shade_coefficients( 255, 128, 64, 255, 1.5f, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 );
+  }
+}
+
+static void bench_emit( void )
+{
+  const uint32_t count = 2000000;
+  double words = bench_best( bench_emit_words, count );
+  double reserve = bench_best( bench_emit_reserve, count );
+  printf( "emit: other modes + fill triangle + texture + shade (%u bytes): word at a time %.1f ns, reserve/commit %.1f ns\n", memory_pos, words, reserve );
+}
+
+/*** TRIANGLE EDGES (FLOAT VS FIXED POINT) ***/
+
+static int32_t bench_triangles[BENCH_TRIANGLES][6]; // S11.2 X,Y Points On A 320x240 Screen
+
+static void bench_setup_float( uint32_t count )
+{
+  for( uint32_t i = 0; i < count; i++ ) {
+    const int32_t *v = bench_triangles[i];
+    memory_pos = 0;
+    rdp_draw_fill_triangle( v[0] / 4.0f, v[1] / 4.0f, v[2] / 4.0f, v[3] / 4.0f, v[4] / 4.0f, v[5] / 4.0f );
+  }
+}
+
+static void bench_setup_fixed( uint32_t count )
+{
+  for( uint32_t i = 0; i < count; i++ ) {
+    const int32_t *v = bench_triangles[i];
+    memory_pos = 0;
+    rdp_draw_fill_triangle_fx( v[0], v[1], v[2], v[3], v[4], v[5] );
+  }
+}
+
+static void bench_encode_float( uint32_t count )
+{
+  for( uint32_t i = 0; i < count; i++ ) {
+    const int32_t *v = bench_triangles[i];
+    memory_pos = 0;
+    rdp_fill_triangle( 1, 0, 0, v[1] * 0.25f, v[3] * 0.25f, v[5] * 0.25f, v[0] * 0.25f, 1.5f, v[2] * 0.25f, -0.75f, v[4] * 0.25f, 2.25f );
+  }
+}
+
+static void bench_encode_fixed( uint32_t count )
+{
+  for( uint32_t i = 0; i < count; i++ ) {
+    const int32_t *v = bench_triangles[i];
+    memory_pos = 0;
+    rdp_triangle_fx( 0x08, 1, 0, 0, v[1], v[3], v[5], v[0] << 14, 98304, v[2] << 14, -49152, v[4] << 14, 147456 );
+  }
+}
+
+// Bit Exactness Of Both Paths Is Checked By rdptest (test_triangle_fx)
+static void bench_triangle_fx( void )
+{
+  for( int i = 0; i < BENCH_TRIANGLES; i++ )
+    for( int k = 0; k < 6; k++ ) bench_triangles[i][k] = bench_random() % ((k & 1) ? 960 : 1280);
+  bench_list_reset();
+
+  double setup_float = bench_best( bench_setup_float, BENCH_TRIANGLES );
+  double setup_fixed = bench_best( bench_setup_fixed, BENCH_TRIANGLES );
+  double encode_float = bench_best( bench_encode_float, BENCH_TRIANGLES );
+  double encode_fixed = bench_best( bench_encode_fixed, BENCH_TRIANGLES );
+  printf( "triangle edges: setup float %.1f ns, fixed %.1f ns; encode float %.1f ns, fixed %.1f ns\n", setup_float, setup_fixed, encode_float, encode_fixed );
+}
+
+/*** SIX CUBE SCENE (FLAT TRIANGLE LIST VS INDEXED MESH) ***/
+
+static float bench_cube_tri[108]; // Reference: Flat X,Y,Z List Of The 36 Cube Triangle Corners (Built From CubeVert & CubeIndex)
+
+static void bench_fill_flat( Mesh3D *mesh, uint8_t cull )
+{
+  fill_triangle_array( bench_cube_tri, mesh->col, cull, 0, 108 );
+}
+
+// Six Cube Scene Of main.c, Rotated Per Frame
+static void bench_cube_scene( uint32_t frame, void (*fill)( Mesh3D *mesh, uint8_t cull ) )
+{
+  bench_list_reset();
+  matrix_identity( Matrix3D );
+  for( int n = 0; n < CUBE_INSTANCES; n++ ) {
+    CubeInstance[n].rot[0] = (frame * (n + 1)) & 1023;
+    CubeInstance[n].rot[1] = (frame * 2) & 1023;
+    CubeInstance[n].rot[2] = (frame * 3) & 1023;
+  }
+  fill_instances( &CubeMesh, CubeInstance, CUBE_INSTANCES, CULL_BACK, Sin256, fill );
+}
+
+static void bench_scene_flat( uint32_t count )
+{
+  for( uint32_t f = 0; f < count; f++ ) bench_cube_scene( f, bench_fill_flat );
+}
+
+static void bench_scene_mesh( uint32_t count )
+{
+  for( uint32_t f = 0; f < count; f++ ) bench_cube_scene( f, fill_mesh );
+}
+
+static void bench_mesh( void )
+{
+  for( int i = 0; i < 36; i++ )
+    for( int k = 0; k < 3; k++ ) bench_cube_tri[i * 3 + k] = CubeVert[CubeIndex[i] * 3 + k];
+
+  // Transforms Per Frame: The Flat List Transforms Every Triangle Corner, The Mesh Each Unique Vertex Of A Visible Face Once
+  uint32_t frames = 1024;
+  stats_3d_reset();
+  bench_scene_mesh( frames );
+  double mesh_transforms = (double)stats_3d.verts_transformed / frames;
+
+  double flat = bench_best( bench_scene_flat, 20000 );
+  double mesh = bench_best( bench_scene_mesh, 20000 );
+  printf( "six cube scene: flat list %d transforms, %.2f us/frame; indexed mesh %.1f transforms, %.2f us/frame\n", CUBE_INSTANCES * 36, flat / 1000, mesh_transforms, mesh / 1000 );
+}
+
+/*** VERTEX TRANSFORM (FLOAT VS FIXED POINT) ***/
+
+static int16_t bench_vert16[BENCH_VERTICES * 3]; // Model X,Y,Z In -30..30
+static float bench_vert[BENCH_VERTICES * 3]; // Same Vertices As Floats
+static XYResult bench_xy[BENCH_VERTICES];
+static XYFixed bench_xy_fixed[BENCH_VERTICES];
+
+static void bench_transform_float( uint32_t count )
+{
+  for( uint32_t i = 0; i < count; i++ ) {
+    XYZResult xyz = calc_3d( Matrix3D, bench_vert[i * 3], bench_vert[i * 3 + 1], bench_vert[i * 3 + 2] );
+    bench_xy[i] = calc_2d( xyz.x, xyz.y, xyz.z );
+  }
+}
+
+static void bench_transform_fixed( uint32_t count )
+{
+  int32_t fixed[12];
+  matrix_fixed( Matrix3D, fixed ); // Once Per Mesh
+  for( uint32_t i = 0; i < count; i++ ) {
+    XYZFixed xyz = calc_3d_fixed( fixed, bench_vert16[i * 3], bench_vert16[i * 3 + 1], bench_vert16[i * 3 + 2] );
+    bench_xy_fixed[i] = calc_2d_fixed( xyz.x, xyz.y, xyz.z );
+  }
+}
+
+// Pixel Error Of The Fixed Point Path Is Checked By rdptest (test_fixed_3d)
+static void bench_fixed_3d( void )
+{
+  for( int i = 0; i < BENCH_VERTICES * 3; i++ ) {
+    bench_vert16[i] = bench_random() % 61 - 30;
+    bench_vert[i] = bench_vert16[i];
+  }
+  matrix_identity( Matrix3D );
+  translate_xyz( Matrix3D, 5, -3, 90 );
+  rotate_xyz( Matrix3D, Sin256, 100, 200, 300 );
+
+  double float_path = bench_best( bench_transform_float, BENCH_VERTICES );
+  double fixed_path = bench_best( bench_transform_fixed, BENCH_VERTICES );
+  printf( "vertex transform: calc_3d + calc_2d %.2f ns, calc_3d_fixed + calc_2d_fixed %.2f ns\n", float_path, fixed_path );
+}
+
+/*** PROJECTION (THREE DIVIDES VS ONE RECIPROCAL) ***/
+
+static float bench_project_vert[BENCH_PROJECT * 3]; // Model X,Y,Z In -25..25
+static XYResult bench_project_xy[BENCH_PROJECT];
+static XYZWResult bench_project_xyzw[BENCH_PROJECT];
+
+static void bench_project_divide( uint32_t count )
+{
+  for( uint32_t i = 0; i < count; i++ ) {
+    const float *v = &bench_project_vert[i * 3];
+    XYZResult xyz = calc_3d( Matrix3D, v[0], v[1], v[2] );
+    bench_project_xy[i] = calc_2d( xyz.x, xyz.y, xyz.z );
+  }
+}
+
+static void bench_project_reciprocal( uint32_t count )
+{
+  float proj[12];
+  matrix_project( Matrix3D, proj ); // Once Per Mesh
+  for( uint32_t i = 0; i < count; i++ ) {
+    const float *v = &bench_project_vert[i * 3];
+    bench_project_xyzw[i] = calc_project( proj, v[0], v[1], v[2] );
+  }
+}
+
+static void bench_project( void )
+{
+  for( int i = 0; i < BENCH_PROJECT * 3; i++ ) bench_project_vert[i] = (int32_t)(bench_random() % 20001 - 10000) / 400.0f;
+  matrix_identity( Matrix3D );
+  translate_xyz( Matrix3D, 5, -3, 90 );
+  rotate_xyz( Matrix3D, Sin256, 100, 200, 300 );
+
+  double divide = bench_best( bench_project_divide, BENCH_PROJECT );
+  double reciprocal = bench_best( bench_project_reciprocal, BENCH_PROJECT );
+
+  // Both Paths Truncate To Whole Pixels: Count Vertices Landing More Than 1 Pixel Apart
+  uint32_t apart = 0;
+  for( int i = 0; i < BENCH_PROJECT; i++ ) {
+    float dx = bench_project_xy[i].x - bench_project_xyzw[i].x, dy = bench_project_xy[i].y - bench_project_xyzw[i].y;
+    apart += dx < -1 || dx > 1 || dy < -1 || dy > 1;
+  }
+  printf( "projection: calc_3d + calc_2d %.2f ns, calc_project %.2f ns (%u of %u vertices more than 1 pixel apart)\n", divide, reciprocal, apart, BENCH_PROJECT );
+}
+
+/*** ROTATION (FLOAT SINE TABLE VS QUARTER WAVE TABLE) ***/
+
+static float bench_sin1024[1024]; // Reference: The Original 1024 Entry Float Sine Table (4 KB)
+static uint16_t bench_angles[BENCH_ROTATIONS * 3]; // Scattered Angles (0..1023)
+static float bench_matrix[12];
+
+// Reference: The Original rotate_xyz On The Float Table
+static void bench_rotate_xyz_float( float matrix[], float precalc[], uint16_t x, uint16_t y, uint16_t z )
+{
+  matrix[1] = precalc[(x + 256) & 1023]; // XC
+  matrix[6] = precalc[x]; // XS
+  matrix[10] = precalc[(y + 256) & 1023]; // YC
+  matrix[2] = precalc[y]; // YS
+  matrix[8] = precalc[(z + 256) & 1023]; // ZC
+  matrix[9] = precalc[z]; // ZS
+  matrix[5] = -matrix[6] * matrix[10];
+  matrix[4] = (matrix[5] * matrix[8]) - (matrix[1] * matrix[9]);
+  matrix[5] = (matrix[5] * matrix[9]) + (matrix[1] * matrix[8]);
+  matrix[1] = matrix[1] * matrix[10];
+  matrix[0] = (matrix[1] * matrix[8]) - (matrix[6] * matrix[9]);
+  matrix[1] = (matrix[1] * matrix[9]) + (matrix[6] * matrix[8]);
+  matrix[6] *= matrix[2];
+  matrix[8] *= matrix[2];
+  matrix[9] *= matrix[2];
+  matrix[2] *= -precalc[(x + 256) & 1023];
+}
+
+static void bench_rotate_float( uint32_t count )
+{
+  for( uint32_t i = 0; i < count; i++ ) bench_rotate_xyz_float( bench_matrix, bench_sin1024, bench_angles[i * 3], bench_angles[i * 3 + 1], bench_angles[i * 3 + 2] );
+}
+
+static void bench_rotate_quarter( uint32_t count )
+{
+  for( uint32_t i = 0; i < count; i++ ) rotate_xyz( bench_matrix, Sin256, bench_angles[i * 3], bench_angles[i * 3 + 1], bench_angles[i * 3 + 2] );
+}
+
+static void bench_rotate( void )
+{
+  for( int i = 0; i < 1024; i++ ) bench_sin1024[i] = sin( i * 3.14159265358979323846 / 512.0 );
+  for( int i = 0; i < BENCH_ROTATIONS * 3; i++ ) bench_angles[i] = bench_random() & 1023;
+
+  // Largest Matrix Element Difference Between The Two Tables
+  double max_diff = 0;
+  for( int i = 0; i < 100000; i++ ) {
+    float a[12], b[12];
+    bench_rotate_xyz_float( a, bench_sin1024, bench_angles[i * 3], bench_angles[i * 3 + 1], bench_angles[i * 3 + 2] );
+    rotate_xyz( b, Sin256, bench_angles[i * 3], bench_angles[i * 3 + 1], bench_angles[i * 3 + 2] );
+    for( int k = 0; k < 11; k++ ) {
+      if( k == 3 || k == 7 ) continue; // Translation Untouched
+      double diff = fabs( a[k] - b[k] );
+      if( diff > max_diff ) max_diff = diff;
+    }
+  }
+
+  double table_float = bench_best( bench_rotate_float, BENCH_ROTATIONS );
+  double table_quarter = bench_best( bench_rotate_quarter, BENCH_ROTATIONS );
+  printf( "rotate_xyz: float table %u bytes %.2f ns, quarter wave table %u bytes %.2f ns (max matrix difference %.1e)\n", (uint32_t)sizeof( bench_sin1024 ), table_float, (uint32_t)sizeof( Sin256 ), table_quarter, max_diff );
+}
+
+/*** INSTANCED SCENE (FILL INSTANCES VS PUSH/TRANSLATE/ROTATE/POP) ***/
+
+static Instance3D bench_instance[BENCH_INSTANCES];
+
+static void bench_fill_none( Mesh3D *mesh, uint8_t cull )
+{
+  (void)mesh;
+  (void)cull;
+}
+
+// Reference: One Matrix Stack Round Trip & Two Concatenations Per Instance
+static void bench_push_pop( void (*fill)( Mesh3D *mesh, uint8_t cull ) )
+{
+  Mesh3D copy = CubeMesh;
+  for( int n = 0; n < BENCH_INSTANCES; n++ ) {
+    Instance3D *in = &bench_instance[n];
+    matrix_push();
+    matrix_translate( Matrix3D, in->pos[0], in->pos[1], in->pos[2] );
+    matrix_rotate_xyz( Matrix3D, Sin256, in->rot[0], in->rot[1], in->rot[2] );
+    copy.col = (in->col != NULL) ? in->col : CubeMesh.col;
+    fill( &copy, CULL_BACK );
+    matrix_pop();
+  }
+}
+
+// Each Run Draws "count" Instances, In Whole Scenes Of BENCH_INSTANCES
+static void bench_scene_run( uint32_t count, int stack, void (*fill)( Mesh3D *mesh, uint8_t cull ) )
+{
+  for( uint32_t i = 0; i < count; i += BENCH_INSTANCES ) {
+    bench_list_reset();
+    matrix_identity( Matrix3D );
+    if( stack ) bench_push_pop( fill );
+    else fill_instances( &CubeMesh, bench_instance, BENCH_INSTANCES, CULL_BACK, Sin256, fill );
+  }
+}
+
+static void bench_instances_none( uint32_t count )
+{
+  bench_scene_run( count, 0, bench_fill_none );
+}
+
+static void bench_push_pop_none( uint32_t count )
+{
+  bench_scene_run( count, 1, bench_fill_none );
+}
+
+static void bench_instances_mesh( uint32_t count )
+{
+  bench_scene_run( count, 0, fill_mesh );
+}
+
+static void bench_push_pop_mesh( uint32_t count )
+{
+  bench_scene_run( count, 1, fill_mesh );
+}
+
+static void bench_instances( void )
+{
+  // Random Cubes In Front Of The Camera, Rotated On All Three Axes
+  for( int n = 0; n < BENCH_INSTANCES; n++ ) {
+    Instance3D *in = &bench_instance[n];
+    in->pos[0] = (float)(bench_random() % 241) - 120;
+    in->pos[1] = (float)(bench_random() % 161) - 80;
+    in->pos[2] = (float)(bench_random() % 300) + 100;
+    for( int k = 0; k < 3; k++ ) in->rot[k] = bench_random() & 1023;
+    in->axes = ROTATE_X | ROTATE_Y | ROTATE_Z;
+    in->col = CubeInstance[n % CUBE_INSTANCES].col;
+  }
+
+  uint32_t count = BENCH_INSTANCES * 400;
+  double instances_none = bench_best( bench_instances_none, count );
+  double push_pop_none = bench_best( bench_push_pop_none, count );
+  double instances_mesh = bench_best( bench_instances_mesh, count );
+  double push_pop_mesh = bench_best( bench_push_pop_mesh, count );
+  printf( "%d instances: matrix only fill_instances %.1f ns, push/pop %.1f ns; with fill_mesh fill_instances %.1f ns, push/pop %.1f ns (per instance)\n", BENCH_INSTANCES, instances_none, push_pop_none, instances_mesh, push_pop_mesh );
+}
+
+/*** DENSE SCENE (Z-BUFFER VS PAINTER'S ORDER) ***/
+
+static Instance3D bench_dense[BENCH_DENSE];
+
+// 7x5 Grid Of Cubes 18 Units Apart (Closer Than Their Rotated Extent), Alternate Cubes 9 Units Deeper, Each Bobbing In Z
+static void bench_dense_scene( uint32_t frame )
+{
+  for( int n = 0; n < BENCH_DENSE; n++ ) {
+    Instance3D *in = &bench_dense[n];
+    int gx = n % 7, gy = n / 7;
+    in->pos[0] = (gx - 3) * 18.0f;
+    in->pos[1] = (gy - 2) * 18.0f;
+    in->pos[2] = 80 + ((gx + gy) & 1) * 9 + 12 * sinf( frame * 0.05f + n );
+    in->rot[0] = (frame * 3 + n * 97) & 1023;
+    in->rot[1] = (frame * 2 + n * 51) & 1023;
+    in->rot[2] = (frame + n * 13) & 1023;
+    in->axes = ROTATE_X | ROTATE_Y | ROTATE_Z;
+    in->col = CubeInstance[n % CUBE_INSTANCES].col;
+  }
+  bench_list_reset();
+  matrix_identity( Matrix3D );
+}
+
+static void bench_dense_painter( uint32_t count )
+{
+  for( uint32_t f = 0; f < count; f++ ) {
+    bench_dense_scene( f );
+    sort_instances( bench_dense, BENCH_DENSE ); // Back To Front Per Frame
+    fill_instances( &CubeMesh, bench_dense, BENCH_DENSE, CULL_BACK, Sin256, fill_mesh );
+  }
+}
+
+static void bench_dense_zbuffer( uint32_t count )
+{
+  for( uint32_t f = 0; f < count; f++ ) {
+    bench_dense_scene( f );
+    fill_instances( &CubeMesh, bench_dense, BENCH_DENSE, CULL_BACK, Sin256, fill_zbuffer_mesh );
+  }
+}
+
+// Pixels Covered By The Triangle Commands Of The List (Area From The Edge Words: Top XH,YH, Mid XL,YM, Low On The Major Edge At YL)
+static double bench_list_pixels( void )
+{
+  double pixels = 0;
+  for( uint32_t pos = 0; pos < memory_pos; pos += rdp_command_length( rdp_peek( pos ) ) << 3 ) {
+    uint32_t hi = rdp_peek( pos ), lo = rdp_peek( pos + 4 );
+    uint8_t op = (hi >> 24) & 0x3F;
+    if( op < 0x08 || op > 0x0F ) continue;
+    double yl = ((int32_t)(hi << 18) >> 18) / 4.0, ym = ((int32_t)(lo << 2) >> 18) / 4.0, yh = ((int32_t)(lo << 18) >> 18) / 4.0;
+    double xl = (int32_t)rdp_peek( pos + 8 ) / 65536.0, xh = (int32_t)rdp_peek( pos + 16 ) / 65536.0, dxhdy = (int32_t)rdp_peek( pos + 20 ) / 65536.0;
+    double xlow = xh + dxhdy * (yl - yh);
+    pixels += fabs( (xl - xh) * (yl - yh) - (xlow - xh) * (ym - yh) ) / 2;
+  }
+  return pixels;
+}
+
+static void bench_zbuffer( void )
+{
+  // List Bytes & Covered Pixels Per Frame (Both Modes Draw The Same Faces, Only The Order & Commands Differ)
+  uint32_t frames = 200;
+  double painter_bytes = 0, zbuffer_bytes = 0, pixels = 0;
+  for( uint32_t f = 0; f < frames; f++ ) {
+    bench_dense_painter( 1 );
+    painter_bytes += memory_pos;
+    bench_dense_zbuffer( 1 );
+    zbuffer_bytes += memory_pos;
+    pixels += bench_list_pixels();
+  }
+  painter_bytes /= frames;
+  zbuffer_bytes /= frames;
+  pixels /= frames;
+
+  // RDRAM Traffic The Z-Buffer Adds: One 320x240x16B Clear, Then A 16-Bit Z Read & Write Per Covered Pixel
+  double clear_bytes = 320 * 240 * 2, z_bytes = clear_bytes + pixels * 4;
+
+  double painter = bench_best( bench_dense_painter, 2000 );
+  double zbuffer = bench_best( bench_dense_zbuffer, 2000 );
+  printf( "dense %d cube scene: painter (sort + fill_mesh) %.2f us, %.0f list bytes; z-buffer (fill_zbuffer_mesh) %.2f us, %.0f list bytes + %.0f Z bytes (%.0f clear, %.0f px read/write) per frame\n",
+    BENCH_DENSE, painter / 1000, painter_bytes, zbuffer / 1000, zbuffer_bytes, z_bytes, clear_bytes, pixels );
+}
+
+/*** MAIN ***/
+
+int main( void )
+{
+  bench_emit();
+  bench_triangle_fx();
+  bench_mesh();
+  bench_fixed_3d();
+  bench_project();
+  bench_rotate();
+  bench_instances();
+  bench_zbuffer();
+
+  rdp_host_free();
+  return 0;
+}
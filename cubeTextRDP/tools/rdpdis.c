@@ -0,0 +1,293 @@
+// RDP Command List Disassembler & Statistics (Host Tool)
+//
+// Decodes a dumped RDP DRAM command list (big endian 32-bit words, as stored in RDRAM)
+// into one line per command with its decoded fields, then prints per-opcode counts,
+// byte totals & sync density for the whole list.
+//
+// Build: make rdpdis (or: gcc -std=c99 -O2 -o rdpdis tools/rdpdis.c)
+// Usage: rdpdis [-s] dump.bin [offset [length]]
+//   -s      Statistics only (no per-command listing)
+//   offset  Byte offset of the list in the file (e.g. 0x100000 for a full RDRAM dump)
+//   length  Byte length of the list (default: to the end of the file)
+//
+// Dumps come from rdp_host_dump (RDP_SINK_HOST builds) or from an emulator RDRAM dump.
+//
+// Define RDPDIS_NO_MAIN before including this file to use only the decoder (decode_triangle)
+// from another host tool (rdptest decodes the triangles it emits with it).
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Decoded Triangle Command (Coefficient Blocks The Opcode Does Not Carry Are Left At 0)
+typedef struct {
+  uint8_t op, lft, level, tile;
+  double yl, ym, yh; // Scanlines Y (Pixels)
+  double xl, dxldy, xh, dxhdy, xm, dxmdy; // Edge X & Slopes (Pixels)
+  double shade[4][4]; // [Value, DxDx, DxDe, DxDy][R, G, B, A] (0..255 Units)
+  double tex[4][3]; // [Value, DxDx, DxDe, DxDy][S, T, W] (S/T In Texels, W Raw)
+  double z[4]; // Z, DzDx, DzDe, DzDy
+} DecodedTriangle;
+
+/*** DECODING ***/
+
+// Sign Extend The Low "bits" Bits Of A Field
+static int32_t sext( uint32_t value, int bits )
+{
+  uint32_t sign = 1u << (bits - 1);
+  value &= (sign << 1) - 1;
+  return (int32_t)(value ^ sign) - (int32_t)sign;
+}
+
+// S15.16 Coefficient From The Integer & Fraction Halves Of A Triangle Coefficient Block (Word i Holds The Integers, Word i + 4 The Fractions)
+static double coefficient( const uint32_t *w, int i, int high )
+{
+  uint32_t whole = high ? (w[i] >> 16) : (w[i] & 0xFFFF);
+  uint32_t frac = high ? (w[i + 4] >> 16) : (w[i + 4] & 0xFFFF);
+  return (int32_t)(whole << 16 | frac) / 65536.0;
+}
+
+// Decode A Triangle Command (w = First Word, n = Words Available)
+// Returns The Number Of Words Decoded: Each Coefficient Block Is Decoded Only When It Fits In n
+static uint32_t decode_triangle( const uint32_t *w, uint32_t n, DecodedTriangle *tri )
+{
+  uint32_t hi = w[0], lo = w[1];
+  memset( tri, 0, sizeof( *tri ) );
+  tri->op = (hi >> 24) & 0x3F;
+  tri->lft = (hi >> 23) & 1;
+  tri->level = (hi >> 19) & 7;
+  tri->tile = (hi >> 16) & 7;
+  tri->yl = sext( hi, 14 ) / 4.0;
+  tri->ym = sext( lo >> 16, 14 ) / 4.0;
+  tri->yh = sext( lo, 14 ) / 4.0;
+  if( n < 8 ) return 2;
+  tri->xl = (int32_t)w[2] / 65536.0;
+  tri->dxldy = (int32_t)w[3] / 65536.0;
+  tri->xh = (int32_t)w[4] / 65536.0;
+  tri->dxhdy = (int32_t)w[5] / 65536.0;
+  tri->xm = (int32_t)w[6] / 65536.0;
+  tri->dxmdy = (int32_t)w[7] / 65536.0;
+  uint32_t words = 8;
+
+  // Value, DxDx, DxDe & DxDy Integer Word Pairs Of A Coefficient Block
+  static const int pair[4] = { 0, 2, 8, 10 };
+
+  if( tri->op & 4 ) { // Shade Coefficients Follow The Edges (R/G/B/A In 0..255 Units)
+    if( n < words + 16 ) return words;
+    const uint32_t *c = &w[words];
+    for( int k = 0; k < 4; k++ ) {
+      tri->shade[k][0] = coefficient( c, pair[k], 1 );
+      tri->shade[k][1] = coefficient( c, pair[k], 0 );
+      tri->shade[k][2] = coefficient( c, pair[k] + 1, 1 );
+      tri->shade[k][3] = coefficient( c, pair[k] + 1, 0 );
+    }
+    words += 16;
+  }
+  if( tri->op & 2 ) { // Texture Coefficients Follow The Edge & Shade Blocks (S/T In Texels, W Raw)
+    if( n < words + 16 ) return words;
+    const uint32_t *t = &w[words];
+    for( int k = 0; k < 4; k++ ) {
+      tri->tex[k][0] = coefficient( t, pair[k], 1 ) / 32.0;
+      tri->tex[k][1] = coefficient( t, pair[k], 0 ) / 32.0;
+      tri->tex[k][2] = coefficient( t, pair[k] + 1, 1 );
+    }
+    words += 16;
+  }
+  if( tri->op & 1 ) { // Z-Buffer Coefficients Come Last
+    if( n < words + 4 ) return words;
+    for( int k = 0; k < 4; k++ ) tri->z[k] = (int32_t)w[words + k] / 65536.0;
+    words += 4;
+  }
+  return words;
+}
+
+#ifndef RDPDIS_NO_MAIN
+
+/*** VARIABLES ***/
+static uint32_t *list = NULL; // Command List Words (Host Byte Order)
+static uint32_t list_words = 0; // Command List Length In 32-Bit Words
+
+static uint32_t op_commands[64]; // Commands Per Opcode
+static uint32_t op_words[64]; // 32-Bit Words Per Opcode
+
+static const char *op_names[64] = {
+  "No Op", 0, 0, 0, 0, 0, 0, 0,
+  "Fill Triangle", "Fill ZBuffer Triangle", "Texture Triangle", "Texture ZBuffer Triangle",
+  "Shade Triangle", "Shade ZBuffer Triangle", "Shade Texture Triangle", "Shade Texture ZBuffer Triangle",
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, "Texture Rectangle", "Texture Rectangle Flip", "Sync Load", "Sync Pipe",
+  "Sync Tile", "Sync Full", "Set Key GB", "Set Key R", "Set Convert", "Set Scissor", "Set Prim Depth", "Set Other Modes",
+  "Load TLUT", 0, "Set Tile Size", "Load Block", "Load Tile", "Set Tile", "Fill Rectangle", "Set Fill Color",
+  "Set Fog Color", "Set Blend Color", "Set Prim Color", "Set Env Color", "Set Combine Mode", "Set Texture Image", "Set Z Image", "Set Color Image"
+};
+
+/*** LISTING ***/
+
+// Command Length In 64-Bit Words (Same Rule As rdp_command_length In src/rdp.c)
+static uint32_t command_length( uint32_t word )
+{
+  uint8_t op = (word >> 24) & 0x3F;
+
+  // Triangles: Edge Coefficients + Shade (Bit 2) + Texture (Bit 1) + Z-Buffer (Bit 0) Coefficients
+  if( op >= 0x08 && op <= 0x0F ) return 4 + ((op & 4) ? 8 : 0) + ((op & 2) ? 8 : 0) + ((op & 1) ? 2 : 0);
+
+  // Texture Rectangle & Texture Rectangle Flip
+  if( op == 0x24 || op == 0x25 ) return 2;
+
+  return 1;
+}
+
+// Print One Decoded Command (w = First Word, n = Words Available)
+static void print_command( uint32_t pos, const uint32_t *w, uint32_t n )
+{
+  uint8_t op = (w[0] >> 24) & 0x3F;
+  const char *name = op_names[op] ? op_names[op] : "Invalid";
+  uint32_t hi = w[0], lo = w[1];
+
+  printf( "%08X: %08X %08X  %-30s", pos, hi, lo, name );
+
+  switch( op ) {
+  case 0x08: case 0x09: case 0x0A: case 0x0B: case 0x0C: case 0x0D: case 0x0E: case 0x0F: {
+    DecodedTriangle tri;
+    uint32_t words = decode_triangle( w, n, &tri );
+    printf( " lft %u level %u tile %u yl %.2f ym %.2f yh %.2f", tri.lft, tri.level, tri.tile, tri.yl, tri.ym, tri.yh );
+    if( words >= 8 ) printf( " xl %.4f dxldy %.4f xh %.4f dxhdy %.4f xm %.4f dxmdy %.4f", tri.xl, tri.dxldy, tri.xh, tri.dxhdy, tri.xm, tri.dxmdy );
+    printf( "%s%s%s", (op & 4) ? " +shade" : "", (op & 2) ? " +texture" : "", (op & 1) ? " +zbuffer" : "" );
+    uint32_t tex = 8 + ((op & 4) ? 16 : 0), zb = tex + ((op & 2) ? 16 : 0);
+    if( (op & 4) && words >= 24 ) printf( " r %.2f g %.2f b %.2f a %.2f drdx %.4f dgdx %.4f dbdx %.4f dadx %.4f drde %.4f dgde %.4f dbde %.4f dade %.4f drdy %.4f dgdy %.4f dbdy %.4f dady %.4f",
+      tri.shade[0][0], tri.shade[0][1], tri.shade[0][2], tri.shade[0][3], tri.shade[1][0], tri.shade[1][1], tri.shade[1][2], tri.shade[1][3],
+      tri.shade[2][0], tri.shade[2][1], tri.shade[2][2], tri.shade[2][3], tri.shade[3][0], tri.shade[3][1], tri.shade[3][2], tri.shade[3][3] );
+    if( (op & 2) && words >= tex + 16 ) printf( " s %.3f t %.3f w %.4f dsdx %.4f dtdx %.4f dwdx %.6f dsde %.4f dtde %.4f dwde %.6f dsdy %.4f dtdy %.4f dwdy %.6f",
+      tri.tex[0][0], tri.tex[0][1], tri.tex[0][2], tri.tex[1][0], tri.tex[1][1], tri.tex[1][2],
+      tri.tex[2][0], tri.tex[2][1], tri.tex[2][2], tri.tex[3][0], tri.tex[3][1], tri.tex[3][2] );
+    if( (op & 1) && words >= zb + 4 ) printf( " z %.4f dzdx %.6f dzde %.6f dzdy %.6f", tri.z[0], tri.z[1], tri.z[2], tri.z[3] );
+    break; }
+  case 0x24: case 0x25:
+    printf( " xl %.2f yl %.2f tile %u xh %.2f yh %.2f",
+      ((hi >> 12) & 0xFFF) / 4.0, (hi & 0xFFF) / 4.0, (lo >> 24) & 7, ((lo >> 12) & 0xFFF) / 4.0, (lo & 0xFFF) / 4.0 );
+    if( n >= 4 ) printf( " s %.3f t %.3f dsdx %.4f dtdy %.4f",
+      sext( w[2] >> 16, 16 ) / 32.0, sext( w[2], 16 ) / 32.0, sext( w[3] >> 16, 16 ) / 1024.0, sext( w[3], 16 ) / 1024.0 );
+    break;
+  case 0x2D:
+    printf( " xh %.2f yh %.2f xl %.2f yl %.2f field %u odd %u",
+      ((hi >> 12) & 0xFFF) / 4.0, (hi & 0xFFF) / 4.0, ((lo >> 12) & 0xFFF) / 4.0, (lo & 0xFFF) / 4.0, (lo >> 25) & 1, (lo >> 24) & 1 );
+    break;
+  case 0x2E:
+    printf( " z %d dz %d", sext( lo >> 16, 16 ), sext( lo, 16 ) );
+    break;
+  case 0x2F: {
+    static const char *cycle[4] = { "1cycle", "2cycle", "copy", "fill" };
+    printf( " %s", cycle[(hi >> 20) & 3] );
+    break; }
+  case 0x30: case 0x32: case 0x34:
+    printf( " sl %.2f tl %.2f tile %u sh %.2f th %.2f",
+      ((hi >> 12) & 0xFFF) / 4.0, (hi & 0xFFF) / 4.0, (lo >> 24) & 7, ((lo >> 12) & 0xFFF) / 4.0, (lo & 0xFFF) / 4.0 );
+    break;
+  case 0x33:
+    printf( " sl %u tl %u tile %u sh %u dxt %.4f",
+      (hi >> 12) & 0xFFF, hi & 0xFFF, (lo >> 24) & 7, (lo >> 12) & 0xFFF, (lo & 0xFFF) / 2048.0 );
+    break;
+  case 0x35:
+    printf( " format %u size %u line %u tmem 0x%03X tile %u palette %u ct %u mt %u maskt %u shiftt %u cs %u ms %u masks %u shifts %u",
+      (hi >> 21) & 7, (hi >> 19) & 3, (hi >> 9) & 0x1FF, hi & 0x1FF, (lo >> 24) & 7, (lo >> 20) & 0xF,
+      (lo >> 19) & 1, (lo >> 18) & 1, (lo >> 14) & 0xF, (lo >> 10) & 0xF, (lo >> 9) & 1, (lo >> 8) & 1, (lo >> 4) & 0xF, lo & 0xF );
+    break;
+  case 0x36:
+    printf( " xh %.2f yh %.2f xl %.2f yl %.2f",
+      ((lo >> 12) & 0xFFF) / 4.0, (lo & 0xFFF) / 4.0, ((hi >> 12) & 0xFFF) / 4.0, (hi & 0xFFF) / 4.0 );
+    break;
+  case 0x37:
+    printf( " 0x%08X", lo );
+    break;
+  case 0x38: case 0x39: case 0x3B:
+    printf( " r %u g %u b %u a %u", lo >> 24, (lo >> 16) & 0xFF, (lo >> 8) & 0xFF, lo & 0xFF );
+    break;
+  case 0x3A:
+    printf( " min level %u lod frac %u r %u g %u b %u a %u", (hi >> 8) & 0x1F, hi & 0xFF, lo >> 24, (lo >> 16) & 0xFF, (lo >> 8) & 0xFF, lo & 0xFF );
+    break;
+  case 0x3D: case 0x3F:
+    printf( " format %u size %u width %u address 0x%08X", (hi >> 21) & 7, (hi >> 19) & 3, (hi & 0x3FF) + 1, lo );
+    break;
+  case 0x3E:
+    printf( " address 0x%08X", lo );
+    break;
+  }
+  printf( "\n" );
+}
+
+/*** MAIN ***/
+
+int main( int argc, char *argv[] )
+{
+  int stats_only = 0;
+  if( argc > 1 && strcmp( argv[1], "-s" ) == 0 ) { stats_only = 1; argc--; argv++; }
+
+  if( argc < 2 || argc > 4 ) {
+    fprintf( stderr, "Usage: rdpdis [-s] dump.bin [offset [length]]\n" );
+    return 1;
+  }
+
+  FILE *file = fopen( argv[1], "rb" );
+  if( file == NULL ) { perror( argv[1] ); return 1; }
+
+  fseek( file, 0, SEEK_END );
+  long size = ftell( file );
+  long offset = (argc > 2) ? strtol( argv[2], NULL, 0 ) : 0;
+  long length = (argc > 3) ? strtol( argv[3], NULL, 0 ) : size - offset;
+  if( offset < 0 || length < 0 || offset + length > size ) {
+    fprintf( stderr, "rdpdis: offset/length outside %s (%ld bytes)\n", argv[1], size );
+    return 1;
+  }
+
+  // Load The List & Convert Big Endian Words To Host Order
+  uint8_t *bytes = malloc( length + 8 );
+  list = malloc( (length >> 2) * 4 + 8 );
+  if( bytes == NULL || list == NULL ) { fprintf( stderr, "rdpdis: out of memory\n" ); return 1; }
+  fseek( file, offset, SEEK_SET );
+  if( fread( bytes, 1, length, file ) != (size_t)length ) { perror( argv[1] ); return 1; }
+  fclose( file );
+
+  list_words = length >> 2;
+  for( uint32_t i = 0; i < list_words; i++ ) list[i] = (uint32_t)bytes[i*4] << 24 | bytes[i*4+1] << 16 | bytes[i*4+2] << 8 | bytes[i*4+3];
+  list[list_words] = list[list_words + 1] = 0;
+  free( bytes );
+
+  // Walk The List One Command At A Time
+  uint32_t invalid = 0, truncated = 0;
+  for( uint32_t i = 0; i < list_words; ) {
+    uint8_t op = (list[i] >> 24) & 0x3F;
+    uint32_t words = command_length( list[i] ) << 1;
+    if( i + words > list_words ) { words = list_words - i; truncated++; }
+
+    if( !stats_only ) print_command( offset + i * 4, &list[i], words );
+
+    op_commands[op]++;
+    op_words[op] += words;
+    if( op_names[op] == 0 ) invalid++;
+    i += words;
+  }
+
+  // Per-Opcode Counts & Byte Totals
+  uint32_t commands = 0, primitives = 0, syncs = 0, sync_bytes = 0, bytes_total = list_words * 4;
+  printf( "\n%-4s %-30s %10s %10s %8s\n", "Op", "Command", "Count", "Bytes", "Share" );
+  for( int op = 0; op < 64; op++ ) {
+    if( op_commands[op] == 0 ) continue;
+    printf( "0x%02X %-30s %10u %10u %7.2f%%\n", op, op_names[op] ? op_names[op] : "Invalid",
+      op_commands[op], op_words[op] * 4, bytes_total ? 100.0 * op_words[op] * 4 / bytes_total : 0.0 );
+    commands += op_commands[op];
+    if( (op >= 0x08 && op <= 0x0F) || op == 0x24 || op == 0x25 || op == 0x36 ) primitives += op_commands[op];
+    if( op >= 0x26 && op <= 0x29 ) { syncs += op_commands[op]; sync_bytes += op_words[op] * 4; }
+  }
+  printf( "     %-30s %10u %10u\n", "Total", commands, bytes_total );
+
+  // Sync Density (Syncs Per Primitive & Share Of The List)
+  printf( "\nPrimitives: %u  Syncs: %u  Syncs/Primitive: %.2f  Sync Bytes: %u (%.2f%%)\n",
+    primitives, syncs, primitives ? (double)syncs / primitives : 0.0, sync_bytes, bytes_total ? 100.0 * sync_bytes / bytes_total : 0.0 );
+  if( invalid || truncated ) printf( "Warning: %u invalid opcode(s), %u truncated command(s): list may be misaligned (missing coefficients?)\n", invalid, truncated );
+
+  free( list );
+  return 0;
+}
+
+#endif // RDPDIS_NO_MAIN
@@ -0,0 +1,861 @@
+// RDP & 3D Host Test Suite
+//
+// Builds the ROM sources with the host command sink (RDP_SINK_HOST) & checks the command
+// lists, data cache writeback ranges & 3D helpers they produce against known values.
+// Prints every failed check, then a summary; exits non-zero when any check failed.
+//
+// Build & Run: make test (or: gcc -std=c99 -DRDP_SINK=RDP_SINK_HOST -O2 -o rdptest tools/rdptest.c -lm)
+#include <math.h>
+#include "../src/rdp.c"
+#include "../src/3d.c"
+#include "../src/3dscene.c"
+#define RDPDIS_NO_MAIN // Reference Decoder Only
+#include "rdpdis.c"
+
+#if RDP_SINK != RDP_SINK_HOST
+#error "rdptest needs the host command sink: build with -DRDP_SINK=RDP_SINK_HOST"
+#endif
+
+/*** CHECKS ***/
+static uint32_t test_checks = 0; // Checks Run
+static uint32_t test_failures = 0; // Checks Failed
+
+#define CHECK(cond) check( (cond), #cond, __LINE__ )
+#define CHECK_EQ(a, b) check_eq( (a), (b), #a, #b, __LINE__ )
+#define CHECK_NEAR(a, b, eps) check_near( (a), (b), (eps), #a, #b, __LINE__ )
+
+// Count A Check, Print It When It Failed
+static void check( int ok, const char *what, int line )
+{
+  test_checks++;
+  if( ok ) return;
+  test_failures++;
+  printf( "rdptest.c:%d: FAIL: %s\n", line, what );
+}
+
+// Integer Equality Check (Prints Both Values On Failure)
+static void check_eq( int64_t a, int64_t b, const char *what_a, const char *what_b, int line )
+{
+  test_checks++;
+  if( a == b ) return;
+  test_failures++;
+  printf( "rdptest.c:%d: FAIL: %s == %s (%lld != %lld)\n", line, what_a, what_b, (long long)a, (long long)b );
+}
+
+// Fixed Seed Pseudo Random Numbers (Same Sequence On Every Host)
+static uint32_t test_seed = 1;
+static uint32_t test_random( void )
+{
+  test_seed = test_seed * 1103515245 + 12345;
+  return test_seed >> 8;
+}
+
+// Start An Empty Command List At Offset 0 (Whole Buffer, No Overflow, Every Hazard Pending)
+static void list_reset( void )
+{
+  memory_start = 0;
+  memory_end = RDP_BUFFER_SIZE;
+  memory_pos = 0;
+  rdp_stats.overflow = 0;
+  rdp_sync_pending = RDP_HAZARD_ALL;
+  rdp_sync_inserted = 0;
+  rdp_state_invalidate();
+}
+
+// Float Check Within A Tolerance (Prints Both Values On Failure)
+static void check_near( double a, double b, double eps, const char *what_a, const char *what_b, int line )
+{
+  test_checks++;
+  if( fabs( a - b ) <= eps ) return;
+  test_failures++;
+  printf( "rdptest.c:%d: FAIL: %s ~= %s (%g != %g)\n", line, what_a, what_b, a, b );
+}
+
+/*** DATA CACHE WRITEBACK ***/
+
+// Writeback One Range & Check The Modelled First Line, End Line & Line Count
+static void check_writeback( uint32_t start, uint32_t end, uint32_t first, uint32_t last, uint32_t lines, int line )
+{
+  uint32_t before = rdp_host_wb_lines;
+  rdp_writeback( start, end );
+  check_eq( rdp_host_wb_start, first, "rdp_host_wb_start", "first", line );
+  check_eq( rdp_host_wb_end, last, "rdp_host_wb_end", "last", line );
+  check_eq( rdp_host_wb_lines - before, lines, "lines written back", "lines", line );
+}
+
+static void test_writeback( void )
+{
+  check_writeback( 0x13, 0x45, 0x10, 0x50, 4, __LINE__ ); // Unaligned Start & End: Partial Lines At Both Ends
+  check_writeback( 0x20, 0x60, 0x20, 0x60, 4, __LINE__ ); // Start & End On Line Boundaries: No Extra Line
+  check_writeback( 0x1F, 0x21, 0x10, 0x30, 2, __LINE__ ); // Two Bytes Straddling A Boundary
+  check_writeback( 0x24, 0x2C, 0x20, 0x30, 1, __LINE__ ); // Inside A Single Line
+  check_writeback( 0x30, 0x40, 0x30, 0x40, 1, __LINE__ ); // Exactly One Line
+  check_writeback( 0x30, 0x31, 0x30, 0x40, 1, __LINE__ ); // One Byte
+
+  // Empty Range: Nothing Written Back, The Last Range Is Kept
+  uint32_t before = rdp_host_wb_lines;
+  rdp_writeback( 0x80, 0x80 );
+  CHECK( rdp_host_wb_lines == before );
+  CHECK_EQ( rdp_host_wb_start, 0x30 );
+}
+
+/*** COMMAND LIST OVERFLOW ***/
+
+static void test_overflow( void )
+{
+  // Word At A Time: A List That Exactly Fills Its Region Is Not An Overflow
+  list_reset();
+  memory_end = 64;
+  for( int i = 0; i < 8; i++ ) rdp_no_op();
+  CHECK_EQ( memory_pos, 64 );
+  CHECK_EQ( rdp_stats.overflow, 0 );
+  rdp_no_op();
+  CHECK_EQ( rdp_stats.overflow, 1 );
+
+  // Whole Primitive Reservation: Same Limit
+  list_reset();
+  memory_end = 64;
+  rdp_fill_triangle( 0, 0, 0, 40, 30, 10, 20, 0, 10, 0.5, 10, 1 );
+  rdp_fill_triangle( 0, 0, 0, 40, 30, 10, 20, 0, 10, 0.5, 10, 1 );
+  CHECK_EQ( memory_pos, 64 );
+  CHECK_EQ( rdp_stats.overflow, 0 );
+  rdp_fill_triangle( 0, 0, 0, 40, 30, 10, 20, 0, 10, 0.5, 10, 1 );
+  CHECK_EQ( rdp_stats.overflow, 1 );
+  CHECK_EQ( memory_pos, 96 ); // Host Sink: Keeps Measuring The Whole List
+
+  // Sync Reservation: Only The Pending Syncs Are Reserved, So A Single Sync Pipe Fits The Last 8 Bytes
+  list_reset();
+  memory_end = 8;
+  rdp_sync_pending = RDP_HAZARD_PIPE;
+  rdp_sync_before( RDP_HAZARD_ALL );
+  CHECK_EQ( memory_pos, 8 );
+  CHECK_EQ( rdp_peek( 0 ) >> 24, 0x27 );
+  CHECK_EQ( rdp_stats.overflow, 0 );
+
+  // Two Pending Syncs In 16 Bytes, Then Nothing Else Fits
+  list_reset();
+  memory_end = 16;
+  rdp_sync_pending = RDP_HAZARD_PIPE | RDP_HAZARD_TILE;
+  rdp_sync_before( RDP_HAZARD_ALL );
+  CHECK_EQ( memory_pos, 16 );
+  CHECK_EQ( rdp_stats.overflow, 0 );
+  rdp_no_op();
+  CHECK_EQ( rdp_stats.overflow, 1 );
+}
+
+/*** SYNC SCHEDULER ***/
+
+// Walk [start, end) & Check Every Sync Against The Hazards Left By The Commands Before It:
+// Sync Pipe Before A State Change Following A Primitive, Sync Load Before A Load Following A Textured Primitive,
+// Sync Tile Before A Tile Change Following A Load Or Textured Primitive & No Sync Anywhere Else
+// Returns The Number Of Syncs Found
+static uint32_t check_syncs( uint32_t start, uint32_t end, int line )
+{
+  int pipe = 1, load = 1, tile = 1; // Unknown At The List Start
+  uint32_t syncs = 0;
+  for( uint32_t pos = start; pos < end; pos += rdp_command_length( rdp_peek( pos ) ) << 3 ) {
+    uint8_t op = (rdp_peek( pos ) >> 24) & 0x3F;
+    switch( op ) {
+      case 0x26: check( load, "sync load only after a textured primitive", line ); load = 0; syncs++; break;
+      case 0x27: check( pipe, "sync pipe only after a primitive", line ); pipe = 0; syncs++; break;
+      case 0x28: check( tile, "sync tile only after a load or textured primitive", line ); tile = 0; syncs++; break;
+      case 0x29: pipe = load = tile = 0; syncs++; break;
+      case 0x08: case 0x09: case 0x0C: case 0x0D: case 0x36: pipe = 1; break; // Untextured Primitives
+      case 0x0A: case 0x0B: case 0x0E: case 0x0F: case 0x24: case 0x25: pipe = load = tile = 1; break; // Textured Primitives
+      case 0x30: case 0x33: case 0x34: check( !load, "sync load before a load", line ); tile = 1; break; // Load TLUT/Block/Tile
+      case 0x32: case 0x35: check( !tile, "sync tile before a tile change", line ); break; // Set Tile Size, Set Tile
+      case 0x3D: break; // Set Texture Image: Only Read By Loads
+      default:
+        if( op >= 0x2A ) check( !pipe, "sync pipe before a state change", line ); // Set Key GB .. Set Color Image
+        break;
+    }
+  }
+  return syncs;
+}
+
+// Textured Draw: Texture Image, Tile & Load, Then A Triangle & A Texture Rectangle
+static void sync_textured_draw( uint32_t address, uint64_t mode )
+{
+  rdp_set_other_modes( mode );
+  rdp_set_texture_image( 0, 2, 32, address );
+  rdp_set_tile( 0, 2, 8, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0 );
+  rdp_load_block( 0, 0, 1023, 0.125, 7 );
+  rdp_set_tile( 0, 2, 8, 0, 0, 0, 0, 0, 5, 0, 0, 0, 5, 0 );
+  rdp_set_tile_size( 0, 0, 31, 31, 0 );
+  rdp_draw_texture_triangle( 10, 10, 0, 0, 1, 50, 20, 31, 0, 1, 20, 60, 0, 31, 1 );
+  rdp_texture_rectangle( 60, 10, 91, 41, 0, 0, 1, 1, 0 );
+}
+
+static void test_sync( void )
+{
+  list_reset();
+
+  // Recorded List: Untextured Then Textured Drawing
+  RDPList list;
+  rdp_list_begin( &list );
+  rdp_set_color_image( 0, 2, 320, 0x00100000 );
+  rdp_set_scissor( 0, 0, 320, 240, 0, 0 );
+  rdp_set_fill_color( 255, 0, 0, 255 );
+  rdp_fill_rectangle( 0, 0, 320, 240 );
+  rdp_set_fill_color( 0, 255, 0, 255 );
+  rdp_set_prim_color( 255, 255, 255, 255 );
+  rdp_fill_rectangle( 10, 10, 20, 20 );
+  rdp_draw_fill_triangle( 10, 10, 50, 20, 20, 60 );
+  sync_textured_draw( 0x00200000, 0x0000000000000001ull );
+  rdp_load_tlut( 0, 0, 255, 0, 7 );
+  rdp_set_tile( 0, 2, 8, 256, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0 );
+  rdp_list_end( &list );
+
+  uint32_t syncs = check_syncs( list.start, list.end, __LINE__ );
+  CHECK( syncs > 0 );
+  CHECK_EQ( syncs, rdp_sync_inserted );
+
+  // Appended After The Recorded List: Pending Hazards Carry Over
+  rdp_list_append( &list );
+  sync_textured_draw( 0x00300000, 0x0000000000000002ull );
+  rdp_set_env_color( 1, 2, 3, 4 );
+  rdp_draw_shade_triangle( 10, 10, 255, 0, 0, 255, 50, 20, 0, 255, 0, 255, 20, 60, 0, 0, 255, 255 );
+  rdp_set_blend_color( 1, 2, 3, 4 );
+
+  syncs = check_syncs( list.start, memory_pos, __LINE__ );
+  CHECK_EQ( syncs, rdp_sync_inserted );
+
+  // Recorded List Starts With Every Hazard Pending: The First State Change Is Synced
+  list_reset();
+  rdp_fill_rectangle( 0, 0, 8, 8 );
+  rdp_list_begin( &list );
+  rdp_set_fill_color( 0, 0, 255, 255 );
+  rdp_list_end( &list );
+  CHECK_EQ( rdp_peek( list.start ) >> 24, 0x27 );
+}
+
+/*** FIXED POINT TRIANGLE EDGES ***/
+
+static void test_triangle_fx( void )
+{
+  uint32_t encoder_diffs = 0, setup_diffs = 0, slope_errors = 0;
+  for( int i = 0; i < 20000; i++ ) {
+    int32_t v[6];
+    for( int k = 0; k < 6; k++ ) v[k] = test_random() % ((k & 1) ? 960 : 1280); // S11.2 Points On A 320x240 Screen
+    float x1 = v[0] / 4.0f, y1 = v[1] / 4.0f, x2 = v[2] / 4.0f, y2 = v[3] / 4.0f, x3 = v[4] / 4.0f, y3 = v[5] / 4.0f;
+
+    // Encoder: Float Arguments & Their S15.16/S11.2 Conversions Give The Same Words
+    float dxldy = (v[0] - v[2]) / 37.0f, dxhdy = v[3] / 13.0f, dxmdy = -v[5] / 7.0f;
+    memory_pos = 0;
+    rdp_fill_triangle( i & 1, 0, 0, y1, y2, y3, x1, dxldy, x2, dxhdy, x3, dxmdy );
+    memory_pos = 64;
+    rdp_triangle_fx( 0x08, i & 1, 0, 0, RDP_S11_2( y1 ), RDP_S11_2( y2 ), RDP_S11_2( y3 ), RDP_S15_16( x1 ), RDP_S15_16( dxldy ), RDP_S15_16( x2 ), RDP_S15_16( dxhdy ), RDP_S15_16( x3 ), RDP_S15_16( dxmdy ) );
+    for( uint32_t w = 0; w < 32; w += 4 ) encoder_diffs += rdp_peek( w ) != rdp_peek( 64 + w );
+
+    // Setup: Integer Setup Matches The Float Setup (Slopes Within 1 LSB, Same Flags & Y)
+    memory_pos = 0;
+    rdp_draw_fill_triangle( x1, y1, x2, y2, x3, y3 );
+    memory_pos = 64;
+    rdp_draw_fill_triangle_fx( v[0], v[1], v[2], v[3], v[4], v[5] );
+    setup_diffs += rdp_peek( 0 ) != rdp_peek( 64 ) || rdp_peek( 4 ) != rdp_peek( 68 );
+    for( uint32_t w = 8; w < 32; w += 4 ) {
+      int64_t d = (int64_t)(int32_t)rdp_peek( w ) - (int32_t)rdp_peek( 64 + w );
+      setup_diffs += d < -1 || d > 1;
+    }
+
+    // Integer Major Edge Slope: Exact (Bottom X - Top X) / (Bottom Y - Top Y), Truncated To S15.16
+    int top = 0, bottom = 0;
+    for( int k = 1; k < 3; k++ ) {
+      if( v[k * 2 + 1] < v[top * 2 + 1] ) top = k;
+      if( v[k * 2 + 1] > v[bottom * 2 + 1] ) bottom = k;
+    }
+    int middle = 3 - top - bottom;
+    if( top != bottom && v[middle * 2 + 1] != v[top * 2 + 1] && v[middle * 2 + 1] != v[bottom * 2 + 1] ) {
+      int64_t exact = (int64_t)(v[bottom * 2] - v[top * 2]) * 65536 / (v[bottom * 2 + 1] - v[top * 2 + 1]);
+      slope_errors += (int32_t)rdp_peek( 64 + 20 ) != exact; // XH Word, Then DxHDy
+    }
+  }
+  CHECK_EQ( encoder_diffs, 0 );
+  CHECK_EQ( setup_diffs, 0 );
+  CHECK_EQ( slope_errors, 0 );
+}
+
+/*** FIXED POINT VERTEX TRANSFORM ***/
+
+// calc_3d_fixed & calc_2d_fixed Against calc_3d & calc_2d: On Screen Vertices Land Within 2 Pixels
+static void test_fixed_3d( void )
+{
+  uint32_t vertices = 0, exact = 0;
+  int32_t max_error = 0;
+  for( int f = 0; f < 64; f++ ) {
+    matrix_identity( Matrix3D );
+    translate_xyz( Matrix3D, (f % 7) * 10 - 30, (f % 5) * 8 - 16, 60 + f );
+    rotate_xyz( Matrix3D, Sin256, (f * 37) & 1023, (f * 91) & 1023, (f * 13) & 1023 );
+    int32_t fixed[12];
+    matrix_fixed( Matrix3D, fixed );
+
+    for( int i = 0; i < 2000; i++ ) {
+      int16_t x = test_random() % 61 - 30, y = test_random() % 61 - 30, z = test_random() % 61 - 30;
+      XYZResult xyz = calc_3d( Matrix3D, x, y, z );
+      if( xyz.z <= NEAR_3D ) continue;
+      XYResult xy = calc_2d( xyz.x, xyz.y, xyz.z );
+      if( xy.x < 0 || xy.x >= 320 || xy.y < 0 || xy.y >= 240 ) continue;
+
+      XYZFixed xyz_fixed = calc_3d_fixed( fixed, x, y, z );
+      XYFixed xy_fixed = calc_2d_fixed( xyz_fixed.x, xyz_fixed.y, xyz_fixed.z );
+      int32_t error_x = abs( (int32_t)xy.x - xy_fixed.x ), error_y = abs( (int32_t)xy.y - xy_fixed.y );
+      int32_t error = error_x > error_y ? error_x : error_y;
+      if( error > max_error ) max_error = error;
+      exact += error == 0;
+      vertices++;
+    }
+  }
+  CHECK( vertices > 50000 );
+  CHECK( max_error <= 2 );
+  CHECK( exact >= vertices / 100 * 99 ); // Nearly Every Vertex Lands On The Same Pixel
+}
+
+/*** FRUSTUM REJECTION ***/
+
+// Brute Force Bound Test On The 8 Box Corners Against The Frustum Planes (Screen Edges Of calc_2d, Near Plane)
+// Outside: All Corners Outside One Plane, Inside: Every Corner Inside Every Plane
+static uint8_t box_bound( const Bound3D *bound )
+{
+  int all_out[5] = { 1, 1, 1, 1, 1 }, all_in = 1;
+  for( int corner = 0; corner < 8; corner++ ) {
+    XYZResult c = calc_3d( Matrix3D, (corner & 1) ? bound->max[0] : bound->min[0], (corner & 2) ? bound->max[1] : bound->min[1], (corner & 4) ? bound->max[2] : bound->min[2] );
+    float d[5] = {
+      (FOV_3D * c.x) + (SCREEN_X_3D * c.z), // Screen X >= 0
+      (SCREEN_X_3D * c.z) - (FOV_3D * c.x), // Screen X <= 320
+      (SCREEN_Y_3D * c.z) - (FOV_3D * c.y), // Screen Y >= 0
+      (FOV_3D * c.y) + (SCREEN_Y_3D * c.z), // Screen Y <= 240
+      c.z - NEAR_3D
+    };
+    for( int p = 0; p < 5; p++ ) {
+      all_out[p] &= d[p] < 0;
+      all_in &= d[p] >= 0;
+    }
+  }
+  if( all_out[0] | all_out[1] | all_out[2] | all_out[3] | all_out[4] ) return BOUND_OUTSIDE;
+  return all_in ? BOUND_INSIDE : BOUND_INTERSECT;
+}
+
+// Random Cubes Placed By Rigid, Scaled Then Rotated & Rotated Then Scaled Matrices:
+// frustum_bound Rejects Exactly The Cubes The Brute Force Test Rejects & Agrees On The Rest
+static void test_frustum( void )
+{
+  static Bound3D cube = { { 0.0, 0.0, 0.0 }, 17.320509, { -10.0, -10.0, -10.0 }, { 10.0, 10.0, 10.0 } };
+  uint32_t rejected = 0, expected = 0, scaled_rejected = 0, mismatches = 0;
+  test_seed = 16;
+  for( int i = 0; i < 30000; i++ ) {
+    float rigid[12], scale[12], rotate[12];
+    matrix_identity( rotate );
+    rotate_xyz( rotate, Sin256, test_random() & 1023, test_random() & 1023, test_random() & 1023 );
+    for( int k = 0; k < 12; k++ ) rigid[k] = rotate[k];
+    translate_xyz( rigid, (int32_t)(test_random() % 601) - 300, (int32_t)(test_random() % 401) - 200, (int32_t)(test_random() % 501) - 100 );
+    matrix_identity( scale );
+    scale[0] = 0.5 + (test_random() % 251) / 100.0;
+    scale[5] = 0.5 + (test_random() % 251) / 100.0;
+    scale[10] = 0.5 + (test_random() % 251) / 100.0;
+
+    if( i % 3 == 0 ) for( int k = 0; k < 12; k++ ) Matrix3D[k] = rigid[k];
+    if( i % 3 == 1 ) matrix_multiply( Matrix3D, rigid, scale ); // Scaled In Model Space, Then Rotated (Orthogonal Columns)
+    if( i % 3 == 2 ) { // Rotated, Then Scaled In Eye Space (Columns No Longer Orthogonal)
+      matrix_multiply( Matrix3D, scale, rotate );
+      Matrix3D[3] = rigid[3]; Matrix3D[7] = rigid[7]; Matrix3D[11] = rigid[11];
+    }
+
+    uint8_t result = frustum_bound( &cube ), brute = box_bound( &cube );
+    rejected += result == BOUND_OUTSIDE;
+    expected += brute == BOUND_OUTSIDE;
+    scaled_rejected += (i % 3) && result == BOUND_OUTSIDE;
+    mismatches += result != brute;
+  }
+  CHECK_EQ( rejected, expected );
+  CHECK_EQ( mismatches, 0 );
+  CHECK( scaled_rejected > 1000 );
+  CHECK( rejected < 30000 - 1000 ); // Plenty Of Cubes Left On Screen
+}
+
+/*** CLIPPER ***/
+
+static XYZResult eye( float x, float y, float z )
+{
+  XYZResult p = { x, y, z };
+  return p;
+}
+
+// Clip Test Of An Eye Space Triangle (Codes From calc_2d, As The Draw Paths Do)
+static uint8_t eye_clip_test( XYZResult p1, XYZResult p2, XYZResult p3 )
+{
+  return clip_test( clip_code( p1.z, calc_2d( p1.x, p1.y, p1.z ) ), clip_code( p2.z, calc_2d( p2.x, p2.y, p2.z ) ), clip_code( p3.z, calc_2d( p3.x, p3.y, p3.z ) ) );
+}
+
+static void test_clip( void )
+{
+  ClipPoint3D poly[CLIP_MAX_VERTS];
+  const float st[6] = { 0, 0, 32, 0, 16, 32 }; // Texel S,T Per Vertex
+
+  // All Three Vertices Behind The Near Plane: Rejected Before The Clipper, Clipped Away In It
+  CHECK_EQ( eye_clip_test( eye( -1, 0, 0.5 ), eye( 1, 0, 0.25 ), eye( 0, 1, -5 ) ), TRI_REJECT );
+  CHECK_EQ( clip_triangle( eye( -1, 0, 0.5 ), eye( 1, 0, 0.25 ), eye( 0, 1, -5 ), st, NULL, CULL_NONE, poly ), 0 );
+
+  // One Vertex Behind: A Quad, New Vertices On The Near Plane 45% Of The Way To Vertex 3 (W 10 -> -10 Crosses 1)
+  CHECK_EQ( eye_clip_test( eye( -1, 0, 10 ), eye( 1, 0, 10 ), eye( 0, 1, -10 ) ), TRI_CLIP );
+  CHECK_EQ( clip_triangle( eye( -1, 0, 10 ), eye( 1, 0, 10 ), eye( 0, 1, -10 ), st, NULL, CULL_NONE, poly ), 4 );
+  CHECK_NEAR( poly[0].z, NEAR_3D, 1e-4 ); // Edge 3 -> 1
+  CHECK_NEAR( poly[0].inv_w, 1.0, 1e-4 );
+  CHECK_NEAR( poly[0].s, 0.45 * 16, 1e-3 );
+  CHECK_NEAR( poly[0].t, 0.45 * 32, 1e-3 );
+  CHECK_NEAR( poly[1].inv_w, 0.1, 1e-6 ); // Vertex 1 & 2 Kept
+  CHECK_NEAR( poly[2].inv_w, 0.1, 1e-6 );
+  CHECK_NEAR( poly[2].s, 32, 1e-6 );
+  CHECK_NEAR( poly[3].z, NEAR_3D, 1e-4 ); // Edge 2 -> 3
+  CHECK_NEAR( poly[3].s, 32 - 0.45 * 16, 1e-3 );
+  CHECK_NEAR( poly[3].t, 0.45 * 32, 1e-3 );
+
+  // Two Vertices Behind: A Smaller Triangle With Vertex 1 & Two Vertices On The Near Plane
+  CHECK_EQ( eye_clip_test( eye( -1, 0, 10 ), eye( 1, 0, -10 ), eye( 0, 1, -10 ) ), TRI_CLIP );
+  CHECK_EQ( clip_triangle( eye( -1, 0, 10 ), eye( 1, 0, -10 ), eye( 0, 1, -10 ), st, NULL, CULL_NONE, poly ), 3 );
+  CHECK_NEAR( poly[0].inv_w, 1.0, 1e-4 ); // Edge 3 -> 1
+  CHECK_NEAR( poly[0].s, 0.45 * 16, 1e-3 );
+  CHECK_NEAR( poly[0].t, 0.45 * 32, 1e-3 );
+  CHECK_NEAR( poly[1].inv_w, 0.1, 1e-6 ); // Vertex 1
+  CHECK_NEAR( poly[2].inv_w, 1.0, 1e-4 ); // Edge 1 -> 2
+  CHECK_NEAR( poly[2].s, 0.45 * 32, 1e-3 );
+  CHECK_NEAR( poly[2].t, 0, 1e-3 );
+
+  // Vertex Exactly On The Near Plane: Inside, Nothing To Clip
+  CHECK_EQ( clip_code( NEAR_3D, calc_2d( -0.25, 0, NEAR_3D ) ) & CLIP_NEAR, 0 );
+  CHECK_EQ( eye_clip_test( eye( -0.25, 0, NEAR_3D ), eye( 1, 0, 10 ), eye( 0, 1, 10 ) ), TRI_ACCEPT );
+  CHECK_EQ( clip_triangle( eye( -0.25, 0, NEAR_3D ), eye( 1, 0, 10 ), eye( 0, 1, 10 ), st, NULL, CULL_NONE, poly ), 3 );
+  CHECK_EQ( poly[0].inv_w, 1.0 );
+  CHECK_EQ( poly[0].x, 100 );
+
+  // Guard Band Crossing: Vertex 1 Lands At Screen X -1040, The Left Guard Plane (X >= -512) Cuts Edges 3 -> 1 & 1 -> 2
+  XYZResult g1 = eye( -10, 0, 2 ), g2 = eye( 1, 0, 10 ), g3 = eye( 0, 1, 10 );
+  CHECK_EQ( clip_code( g1.z, calc_2d( g1.x, g1.y, g1.z ) ) & CLIP_LEFT, CLIP_LEFT );
+  CHECK_EQ( eye_clip_test( g1, g2, g3 ), TRI_CLIP );
+  CHECK_EQ( clip_triangle( g1, g2, g3, st, NULL, CULL_NONE, poly ), 4 );
+  double d1 = (FOV_3D * g1.x) + (SCREEN_X_3D * g1.z) + (GUARD_BAND_3D * g1.z); // Signed Distances To The Left Guard Plane
+  double d2 = (FOV_3D * g2.x) + (SCREEN_X_3D * g2.z) + (GUARD_BAND_3D * g2.z);
+  double d3 = (FOV_3D * g3.x) + (SCREEN_X_3D * g3.z) + (GUARD_BAND_3D * g3.z);
+  double t31 = d3 / (d3 - d1), t21 = d2 / (d2 - d1); // Interpolated From The Inside Vertex
+  CHECK_NEAR( poly[0].x, -GUARD_BAND_3D, 1 );
+  CHECK_NEAR( poly[0].z, g3.z + t31 * (g1.z - g3.z), 1e-3 );
+  CHECK_NEAR( poly[0].inv_w, 1.0 / (g3.z + t31 * (g1.z - g3.z)), 1e-5 );
+  CHECK_NEAR( poly[0].s, st[4] + t31 * (st[0] - st[4]), 1e-3 ); // S,T Linear In Homogeneous Space (Perspective Correct)
+  CHECK_NEAR( poly[0].t, st[5] + t31 * (st[1] - st[5]), 1e-3 );
+  CHECK_NEAR( poly[1].x, -GUARD_BAND_3D, 1 );
+  CHECK_NEAR( poly[1].inv_w, 1.0 / (g2.z + t21 * (g1.z - g2.z)), 1e-5 );
+  CHECK_NEAR( poly[1].s, st[2] + t21 * (st[0] - st[2]), 1e-3 );
+  CHECK_NEAR( poly[1].t, st[3] + t21 * (st[1] - st[3]), 1e-3 );
+
+  // Near Plane & All Four Guard Band Sides: A Fan Of CLIP_MAX_VERTS Vertices, Every One Inside The Clip Volume
+  XYZResult f1 = eye( -27, 20, 21 ), f2 = eye( 17, -22, 20 ), f3 = eye( 2, 1, -7 );
+  uint8_t count = clip_triangle( f1, f2, f3, NULL, NULL, CULL_NONE, poly );
+  CHECK_EQ( count, CLIP_MAX_VERTS );
+  for( uint8_t k = 0; k < count; k++ ) {
+    CHECK( poly[k].z >= NEAR_3D - 1e-4 );
+    CHECK( poly[k].x >= -GUARD_BAND_3D - 1 && poly[k].x <= (2.0 * SCREEN_X_3D) + GUARD_BAND_3D );
+    CHECK( poly[k].y >= -GUARD_BAND_3D - 1 && poly[k].y <= (2.0 * SCREEN_Y_3D) + GUARD_BAND_3D );
+  }
+
+  // Drawn Through fill_triangle_array: One Blend Color, Then CLIP_MAX_VERTS - 2 Fan Triangles
+  float vert[9] = { f1.x, f1.y, f1.z, f2.x, f2.y, f2.z, f3.x, f3.y, f3.z };
+  uint8_t col[4] = { 255, 0, 0, 255 };
+  list_reset();
+  matrix_identity( Matrix3D );
+  fill_triangle_array( vert, col, CULL_NONE, 0, 9 );
+  uint32_t triangles = 0;
+  for( uint32_t pos = 0; pos < memory_pos; pos += rdp_command_length( rdp_peek( pos ) ) << 3 ) triangles += (rdp_peek( pos ) >> 24) == 0x08;
+  CHECK_EQ( triangles, CLIP_MAX_VERTS - 2 );
+}
+
+/*** TRIANGLE DECODE ***/
+
+// Decode The First Triangle Command Between start & memory_pos With The rdpdis Decoder
+// Returns Its Words (0 When There Is None) & Stores Its Byte Position In *at
+static uint32_t decode_list_triangle( uint32_t start, DecodedTriangle *tri, uint32_t *at )
+{
+  uint32_t w[44];
+  for( uint32_t pos = start; pos < memory_pos; pos += rdp_command_length( rdp_peek( pos ) ) << 3 ) {
+    uint8_t op = (rdp_peek( pos ) >> 24) & 0x3F;
+    if( op < 0x08 || op > 0x0F ) continue;
+    uint32_t n = (memory_pos - pos) >> 2;
+    if( n > 44 ) n = 44;
+    for( uint32_t i = 0; i < n; i++ ) w[i] = rdp_peek( pos + i * 4 );
+    *at = pos;
+    return decode_triangle( w, n, tri );
+  }
+  return 0;
+}
+
+// Value Of A Decoded Attribute Plane At X,Y (Value At The Top Vertex XH,YH Plus The X & Y Gradients)
+static double plane_at( const DecodedTriangle *tri, double value, double dx, double dy, double x, double y )
+{
+  return value + dx * (x - tri->xh) + dy * (y - tri->yh);
+}
+
+// Random Screen Triangle In S11.2 Steps, Not A Sliver (Twice The Area >= 4000 Pixels, So Gradients Stay Within S15.16)
+static void test_triangle_xy( float xy[6] )
+{
+  for( ;; ) {
+    for( int k = 0; k < 6; k++ ) xy[k] = (test_random() % ((k & 1) ? 960 : 1280)) / 4.0f;
+    double nz = (xy[4] - xy[0]) * (xy[3] - xy[1]) - (xy[5] - xy[1]) * (xy[2] - xy[0]);
+    if( fabs( nz ) >= 4000 ) return;
+  }
+}
+
+// rdp_draw_texture_triangle: The 8 Texture Coefficient Dwords Follow The 4 Edge Dwords & The S/T/W Planes Pass Through Every Vertex
+static void test_texture_triangle( void )
+{
+  uint32_t length_errors = 0, plane_errors = 0, edge_errors = 0;
+  for( int i = 0; i < 2000; i++ ) {
+    float xy[6], stw[9];
+    test_triangle_xy( xy );
+    for( int k = 0; k < 3; k++ ) {
+      stw[k * 3] = (test_random() % 2048) / 32.0f; // S,T In 0..64 Texels
+      stw[k * 3 + 1] = (test_random() % 2048) / 32.0f;
+      stw[k * 3 + 2] = 1000 + test_random() % 31767; // W Raw
+    }
+
+    list_reset();
+    rdp_draw_texture_triangle( xy[0], xy[1], stw[0], stw[1], stw[2], xy[2], xy[3], stw[3], stw[4], stw[5], xy[4], xy[5], stw[6], stw[7], stw[8] );
+    DecodedTriangle tri;
+    uint32_t at = 0, words = decode_list_triangle( 0, &tri, &at );
+    length_errors += tri.op != 0x0A || words != (4 + 8) * 2 || at + words * 4 != memory_pos || (rdp_command_length( rdp_peek( at ) ) << 1) != words;
+
+    for( int k = 0; k < 3; k++ ) {
+      double x = xy[k * 2], y = xy[k * 2 + 1];
+      plane_errors += fabs( plane_at( &tri, tri.tex[0][0], tri.tex[1][0], tri.tex[3][0], x, y ) - stw[k * 3] ) > 0.05;
+      plane_errors += fabs( plane_at( &tri, tri.tex[0][1], tri.tex[1][1], tri.tex[3][1], x, y ) - stw[k * 3 + 1] ) > 0.05;
+      plane_errors += fabs( plane_at( &tri, tri.tex[0][2], tri.tex[1][2], tri.tex[3][2], x, y ) - stw[k * 3 + 2] ) > 1e-3 * stw[k * 3 + 2];
+    }
+
+    // Edge Gradients Step Down The Major Edge: DaDe = DaDy + DaDx * DxHDy (Within The Rounding Of Both Terms)
+    for( int a = 0; a < 3; a++ ) {
+      double step = tri.tex[1][a] * tri.dxhdy;
+      edge_errors += fabs( tri.tex[2][a] - (tri.tex[3][a] + step) ) > 1e-3 * (1 + fabs( tri.tex[3][a] ) + fabs( step ));
+    }
+  }
+  CHECK_EQ( length_errors, 0 );
+  CHECK_EQ( plane_errors, 0 );
+  CHECK_EQ( edge_errors, 0 );
+
+  // Known Triangle: Top Vertex (10, 20) Carries S,T,W = 4, 8, 32767, S Doubles Per Pixel Across X, T Per Pixel Down Y
+  list_reset();
+  rdp_draw_texture_triangle( 10, 20, 4, 8, 32767, 110, 120, 204, 108, 32767, 10, 120, 4, 108, 32767 );
+  DecodedTriangle tri;
+  uint32_t at = 0;
+  CHECK_EQ( decode_list_triangle( 0, &tri, &at ), 24 );
+  CHECK_NEAR( tri.yh, 20, 0 );
+  CHECK_NEAR( tri.ym, 120, 0 );
+  CHECK_NEAR( tri.yl, 120, 0 );
+  CHECK_NEAR( tri.tex[0][0], 4, 1e-4 );
+  CHECK_NEAR( tri.tex[0][1], 8, 1e-4 );
+  CHECK_NEAR( tri.tex[0][2], 32767, 1e-4 );
+  CHECK_NEAR( tri.tex[1][0], 2, 1e-4 ); // DsDx
+  CHECK_NEAR( tri.tex[3][1], 1, 1e-4 ); // DtDy
+  CHECK_NEAR( tri.tex[1][2], 0, 1e-4 ); // Constant W
+}
+
+// Gradients Of One Attribute Plane Through 3 Vertices In Double Precision (0 For A Degenerate Triangle)
+// Returns The Determinant (0 When The Vertices Are Collinear & No Plane Passes Through Them)
+static double plane_gradients( const float xy[6], double a1, double a2, double a3, double *dx, double *dy )
+{
+  double mx = xy[2] - xy[0], my = xy[3] - xy[1], hx = xy[4] - xy[0], hy = xy[5] - xy[1];
+  double nz = hx * my - hy * mx;
+  *dx = (nz == 0) ? 0 : -(hy * (a2 - a1) - my * (a3 - a1)) / nz;
+  *dy = (nz == 0) ? 0 : -(mx * (a3 - a1) - hx * (a2 - a1)) / nz;
+  return nz;
+}
+
+// Shade Block Of One Triangle Against Double Precision Gradients (Returns The Number Of Mismatched Coefficients)
+static uint32_t shade_errors( const float xy[6], const float rgba[12] )
+{
+  list_reset();
+  rdp_draw_shade_triangle( xy[0], xy[1], rgba[0], rgba[1], rgba[2], rgba[3], xy[2], xy[3], rgba[4], rgba[5], rgba[6], rgba[7], xy[4], xy[5], rgba[8], rgba[9], rgba[10], rgba[11] );
+  DecodedTriangle tri;
+  uint32_t at = 0, errors = 0;
+  if( decode_list_triangle( 0, &tri, &at ) != (4 + 8) * 2 || tri.op != 0x0C ) return 1;
+  for( int c = 0; c < 4; c++ ) {
+    double dx, dy;
+    double nz = plane_gradients( xy, rgba[c], rgba[4 + c], rgba[8 + c], &dx, &dy );
+    double de = dy + dx * tri.dxhdy;
+    errors += fabs( tri.shade[1][c] - dx ) > 1e-3 + 1e-4 * fabs( dx ); // S15.16 Step & Float Rounding
+    errors += fabs( tri.shade[3][c] - dy ) > 1e-3 + 1e-4 * fabs( dy );
+    errors += fabs( tri.shade[2][c] - de ) > 1e-3 + 1e-4 * (fabs( dy ) + fabs( dx * tri.dxhdy ));
+    for( int k = 0; k < 3 && nz != 0; k++ ) errors += fabs( plane_at( &tri, tri.shade[0][c], tri.shade[1][c], tri.shade[3][c], xy[k * 2], xy[k * 2 + 1] ) - rgba[k * 4 + c] ) > 0.05;
+  }
+  return errors;
+}
+
+// rdp_draw_shade_triangle: R/G/B/A Gradients Against Double Precision Planes
+static void test_shade_triangle( void )
+{
+  uint32_t errors = 0;
+  for( int i = 0; i < 2000; i++ ) {
+    float xy[6], rgba[12];
+    test_triangle_xy( xy );
+    for( int k = 0; k < 12; k++ ) rgba[k] = test_random() % 256;
+    errors += shade_errors( xy, rgba );
+  }
+  CHECK_EQ( errors, 0 );
+
+  // Degenerate Triangle (Collinear, Zero Determinant): No Gradients, The Top Vertex Color Everywhere
+  const float line[6] = { 10, 10, 20, 20, 30, 30 };
+  const float ramp[12] = { 0, 64, 128, 255, 100, 64, 0, 255, 200, 64, 50, 255 };
+  CHECK_EQ( shade_errors( line, ramp ), 0 );
+  DecodedTriangle tri;
+  uint32_t at = 0;
+  decode_list_triangle( 0, &tri, &at );
+  for( int c = 0; c < 4; c++ ) {
+    CHECK_NEAR( tri.shade[0][c], ramp[c], 0 );
+    CHECK_NEAR( tri.shade[1][c], 0, 0 );
+    CHECK_NEAR( tri.shade[2][c], 0, 0 );
+    CHECK_NEAR( tri.shade[3][c], 0, 0 );
+  }
+
+  // Saturated Channel: R Stays At 255 (Exact, No Wrap Into The Sign Bit) Beside A Full 0..255 Green Ramp Across X
+  const float wide[6] = { 0, 0, 319, 0, 0, 239 };
+  const float saturated[12] = { 255, 0, 0, 255, 255, 255, 0, 255, 255, 0, 0, 255 };
+  CHECK_EQ( shade_errors( wide, saturated ), 0 );
+  decode_list_triangle( 0, &tri, &at );
+  CHECK_NEAR( tri.shade[0][0], 255, 0 );
+  CHECK_NEAR( tri.shade[1][0], 0, 0 );
+  CHECK_NEAR( tri.shade[3][0], 0, 0 );
+  CHECK_NEAR( tri.shade[1][1], 255.0 / 319, 1e-4 );
+  for( int k = 0; k < 3; k++ ) CHECK( plane_at( &tri, tri.shade[0][1], tri.shade[1][1], tri.shade[3][1], wide[k * 2], wide[k * 2 + 1] ) <= 255 + 0.05 );
+}
+
+// Draw One Triangle Variant (Command 0x08..0x0F) From 3 Vertices: X, Y, R, G, B, A, S, T, W, Z (The RDP_VTX_* Lanes)
+static void draw_variant( uint8_t op, float v[3][RDP_VTX_SIZE] )
+{
+  const float *a = v[0], *b = v[1], *c = v[2];
+  switch( op ) {
+  case 0x08: rdp_draw_fill_triangle( a[0], a[1], b[0], b[1], c[0], c[1] ); break;
+  case 0x09: rdp_draw_fill_zbuffer_triangle( a[0], a[1], a[9], b[0], b[1], b[9], c[0], c[1], c[9] ); break;
+  case 0x0A: rdp_draw_texture_triangle( a[0], a[1], a[6], a[7], a[8], b[0], b[1], b[6], b[7], b[8], c[0], c[1], c[6], c[7], c[8] ); break;
+  case 0x0B: rdp_draw_texture_zbuffer_triangle( a[0], a[1], a[9], a[6], a[7], a[8], b[0], b[1], b[9], b[6], b[7], b[8], c[0], c[1], c[9], c[6], c[7], c[8] ); break;
+  case 0x0C: rdp_draw_shade_triangle( a[0], a[1], a[2], a[3], a[4], a[5], b[0], b[1], b[2], b[3], b[4], b[5], c[0], c[1], c[2], c[3], c[4], c[5] ); break;
+  case 0x0D: rdp_draw_shade_zbuffer_triangle( a[0], a[1], a[9], a[2], a[3], a[4], a[5], b[0], b[1], b[9], b[2], b[3], b[4], b[5], c[0], c[1], c[9], c[2], c[3], c[4], c[5] ); break;
+  case 0x0E: rdp_draw_shade_texture_triangle( a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8], b[0], b[1], b[2], b[3], b[4], b[5], b[6], b[7], b[8], c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], c[8] ); break;
+  case 0x0F: rdp_draw_shade_texture_zbuffer_triangle( a[0], a[1], a[9], a[2], a[3], a[4], a[5], a[6], a[7], a[8], b[0], b[1], b[9], b[2], b[3], b[4], b[5], b[6], b[7], b[8], c[0], c[1], c[9], c[2], c[3], c[4], c[5], c[6], c[7], c[8] ); break;
+  }
+}
+
+// All Eight Triangle Setups: Command Lengths, Then Edges & Coefficients Of A Known Triangle, Then Agreement On Random Triangles
+static void test_triangle_variants( void )
+{
+  // Top (40, 20), Mid (100, 80), Low (20, 140): Left Major, XH = XM = 40, XL = 100
+  float v[3][RDP_VTX_SIZE] = {
+    { 40, 20, 255, 0, 64, 255, 0, 0, 32767, 1000 },
+    { 100, 80, 0, 255, 64, 128, 32, 0, 16000, 8000 },
+    { 20, 140, 0, 0, 192, 0, 0, 32, 8000, 30000 }
+  };
+  const float xy[6] = { 40, 20, 100, 80, 20, 140 };
+  const double dxhdy = -20.0 / 120, dxmdy = 60.0 / 60, dxldy = -80.0 / 60;
+
+  for( uint8_t op = 0x08; op <= 0x0F; op++ ) {
+    list_reset();
+    draw_variant( op, v );
+    DecodedTriangle tri;
+    uint32_t at = 0, words = decode_list_triangle( 0, &tri, &at );
+    uint32_t dwords = 4 + ((op & 4) ? 8 : 0) + ((op & 2) ? 8 : 0) + ((op & 1) ? 2 : 0);
+    CHECK_EQ( tri.op, op );
+    CHECK_EQ( words, dwords * 2 );
+    CHECK_EQ( at + words * 4, memory_pos );
+    CHECK_EQ( tri.lft, 1 );
+    CHECK_NEAR( tri.yh, 20, 0 );
+    CHECK_NEAR( tri.ym, 80, 0 );
+    CHECK_NEAR( tri.yl, 140, 0 );
+    CHECK_NEAR( tri.xh, 40, 0 );
+    CHECK_NEAR( tri.xm, 40, 0 );
+    CHECK_NEAR( tri.xl, 100, 0 );
+    CHECK_NEAR( tri.dxhdy, dxhdy, 1.0 / 65536 );
+    CHECK_NEAR( tri.dxmdy, dxmdy, 1.0 / 65536 );
+    CHECK_NEAR( tri.dxldy, dxldy, 1.0 / 65536 );
+
+    // Each Block The Command Carries: Top Vertex Value & Double Precision Gradients (Blocks It Does Not Carry Decode As 0)
+    for( int lane = RDP_VTX_R; lane < RDP_VTX_SIZE; lane++ ) {
+      double dx, dy, *block;
+      plane_gradients( xy, v[0][lane], v[1][lane], v[2][lane], &dx, &dy );
+      double scale = 1.0 / 65536; // S15.16 Step
+      int carried = (lane <= RDP_VTX_A) ? (op & 4) : (lane <= RDP_VTX_W) ? (op & 2) : (op & 1);
+      if( lane <= RDP_VTX_A ) block = &tri.shade[0][lane - RDP_VTX_R];
+      else if( lane <= RDP_VTX_W ) block = &tri.tex[0][lane - RDP_VTX_S];
+      else block = &tri.z[0];
+      int stride = (lane <= RDP_VTX_A) ? 4 : (lane <= RDP_VTX_W) ? 3 : 1;
+      CHECK_NEAR( block[0], carried ? v[0][lane] : 0, scale );
+      CHECK_NEAR( block[stride], carried ? dx : 0, 2 * scale + 1e-5 * fabs( dx ) );
+      CHECK_NEAR( block[stride * 2], carried ? dy + dx * dxhdy : 0, 2 * scale + 1e-5 * (fabs( dy ) + fabs( dx )) );
+      CHECK_NEAR( block[stride * 3], carried ? dy : 0, 2 * scale + 1e-5 * fabs( dy ) );
+    }
+  }
+
+  // Random Triangles: Every Variant Encodes The Same Edges & The Same Blocks As The Others Carrying Them
+  uint32_t mismatches = 0;
+  for( int i = 0; i < 500; i++ ) {
+    float r[3][RDP_VTX_SIZE], rxy[6];
+    test_triangle_xy( rxy );
+    for( int k = 0; k < 3; k++ ) {
+      r[k][RDP_VTX_X] = rxy[k * 2];
+      r[k][RDP_VTX_Y] = rxy[k * 2 + 1];
+      for( int lane = RDP_VTX_R; lane <= RDP_VTX_A; lane++ ) r[k][lane] = test_random() % 256;
+      r[k][RDP_VTX_S] = (test_random() % 2048) / 32.0f;
+      r[k][RDP_VTX_T] = (test_random() % 2048) / 32.0f;
+      r[k][RDP_VTX_W] = 1000 + test_random() % 31767;
+      r[k][RDP_VTX_Z] = test_random() % 32768;
+    }
+    DecodedTriangle full, tri;
+    uint32_t at = 0;
+    list_reset();
+    draw_variant( 0x0F, r );
+    decode_list_triangle( 0, &full, &at );
+    for( uint8_t op = 0x08; op < 0x0F; op++ ) {
+      list_reset();
+      draw_variant( op, r );
+      decode_list_triangle( 0, &tri, &at );
+      mismatches += tri.lft != full.lft || tri.yh != full.yh || tri.ym != full.ym || tri.yl != full.yl;
+      mismatches += tri.xh != full.xh || tri.xm != full.xm || tri.xl != full.xl || tri.dxhdy != full.dxhdy || tri.dxmdy != full.dxmdy || tri.dxldy != full.dxldy;
+      if( op & 4 ) mismatches += memcmp( tri.shade, full.shade, sizeof( tri.shade ) ) != 0;
+      if( op & 2 ) mismatches += memcmp( tri.tex, full.tex, sizeof( tri.tex ) ) != 0;
+      if( op & 1 ) mismatches += memcmp( tri.z, full.z, sizeof( tri.z ) ) != 0;
+    }
+  }
+  CHECK_EQ( mismatches, 0 );
+}
+
+// Z-Buffer Array Paths: Depths Stay Within 0..DEPTH_3D Across The Near Plane, Points Behind It Are Skipped
+static void test_zbuffer_depth( void )
+{
+  // A Triangle Crossing The Near Plane (Clipped) & One In Front Of It (Accepted): Every Fan Vertex Depth In Range
+  XYZResult f1 = eye( -27, 20, 21 ), f2 = eye( 17, -22, 20 ), f3 = eye( 2, 1, -7 );
+  float vert[18] = { f1.x, f1.y, f1.z, f2.x, f2.y, f2.z, f3.x, f3.y, f3.z, -2, 0, 10, 2, 0, 10, 0, 2, 20 };
+  uint8_t col[8] = { 255, 0, 0, 255, 0, 255, 0, 255 };
+  list_reset();
+  matrix_identity( Matrix3D );
+  fill_zbuffer_triangle_array( vert, col, CULL_NONE, 0, 18 );
+  uint32_t triangles = 0, depth_errors = 0;
+  for( uint32_t pos = 0; pos < memory_pos; pos += rdp_command_length( rdp_peek( pos ) ) << 3 ) {
+    DecodedTriangle tri;
+    uint32_t at = 0;
+    if( (rdp_peek( pos ) >> 24) != 0x09 || decode_list_triangle( pos, &tri, &at ) != 12 ) continue;
+    triangles++;
+    double x[3] = { tri.xh, tri.xl, tri.xh + tri.dxhdy * (tri.yl - tri.yh) }, y[3] = { tri.yh, tri.ym, tri.yl }; // Top, Mid & Low Vertex
+    for( int k = 0; k < 3; k++ ) {
+      double z = tri.z[0] + tri.z[1] * (x[k] - tri.xh) + tri.z[3] * (y[k] - tri.yh);
+      depth_errors += !(z >= -1 && z <= DEPTH_3D + 1) || isnan( z );
+    }
+  }
+  CHECK_EQ( triangles, CLIP_MAX_VERTS - 2 + 1 );
+  CHECK_EQ( depth_errors, 0 );
+
+  // Points: Behind The Eye & Between It & The Near Plane Are Skipped, One On The Near Plane Gets Depth 0
+  float points[12] = { 0, 0, -5, 0, 0, 0.5, 0, 0, NEAR_3D, 0, 0, 100 };
+  uint8_t point_col[16] = { 0 };
+  list_reset();
+  fill_zbuffer_point_array( points, point_col, 2, 0, 12 );
+  uint32_t rectangles = 0, depths = 0;
+  for( uint32_t pos = 0; pos < memory_pos; pos += rdp_command_length( rdp_peek( pos ) ) << 3 ) {
+    uint8_t op = rdp_peek( pos ) >> 24 & 0x3F;
+    rectangles += op == 0x36;
+    if( op != 0x2E ) continue;
+    int16_t z = rdp_peek( pos + 4 ) >> 16;
+    CHECK_EQ( z, depths ? (int16_t)depth_3d( 1.0 / 100 ) : 0 );
+    depths++;
+  }
+  CHECK_EQ( rectangles, 2 );
+  CHECK_EQ( depths, 2 );
+}
+
+// Nearest Transformed Mesh Vertex To A Decoded Screen Position
+static uint16_t nearest_mesh_vertex( const Mesh3D *mesh, double x, double y )
+{
+  uint16_t best = 0;
+  double best_d = 1e30;
+  for( uint16_t n = 0; n < mesh->vert_count; n++ ) {
+    double d = (MeshXY[n].x - x) * (MeshXY[n].x - x) + (MeshXY[n].y - y) * (MeshXY[n].y - y);
+    if( d < best_d ) { best_d = d; best = n; }
+  }
+  return best;
+}
+
+// fill_shade_mesh On CubeMesh: Vertex Color Planes Through Every Corner, Flat Face Colors Without vert_col (Also When Clipped)
+static void test_shade_mesh( void )
+{
+  uint8_t face_col[48];
+  for( int t = 0; t < 12; t++ ) {
+    face_col[t * 4] = 20 + t * 19;
+    face_col[t * 4 + 1] = 250 - t * 17;
+    face_col[t * 4 + 2] = t * 7;
+    face_col[t * 4 + 3] = 255;
+  }
+  Mesh3D mesh = CubeMesh;
+
+  for( int pass = 0; pass < 3; pass++ ) { // Vertex Colors, Face Colors, Face Colors Across The Near Plane
+    mesh.vert_col = (pass == 0) ? CubeVertCol : NULL;
+    mesh.col = face_col;
+    Instance3D inst = CubeInstance[0]; // Placed Like A Scene Cube, Rotated On All Three Axes
+    inst.pos[0] = 0;
+    inst.pos[1] = 0;
+    inst.pos[2] = (pass == 2) ? 14 : 60;
+    inst.rot[0] = 100;
+    inst.rot[1] = 200;
+    inst.rot[2] = 300;
+    inst.axes = ROTATE_X | ROTATE_Y | ROTATE_Z;
+    inst.col = NULL; // The Mesh Colors
+    list_reset();
+    matrix_identity( Matrix3D );
+    fill_instances( &mesh, &inst, 1, CULL_BACK, Sin256, fill_shade_mesh );
+
+    uint32_t visible = 0, triangles = 0, errors = 0;
+    for( int t = 0; t < 12; t++ ) visible += MeshFaceVisible[t];
+    for( uint32_t pos = 0; pos < memory_pos; pos += rdp_command_length( rdp_peek( pos ) ) << 3 ) {
+      DecodedTriangle tri;
+      uint32_t at = 0;
+      if( (rdp_peek( pos ) >> 24) != 0x0C || decode_list_triangle( pos, &tri, &at ) != 24 ) continue;
+      triangles++;
+
+      if( mesh.vert_col == NULL ) { // Flat: No Gradients & The Color Of A Visible Face
+        int face = -1;
+        for( int t = 0; t < 12; t++ )
+          if( MeshFaceVisible[t] && tri.shade[0][0] == face_col[t * 4] && tri.shade[0][1] == face_col[t * 4 + 1] && tri.shade[0][2] == face_col[t * 4 + 2] && tri.shade[0][3] == face_col[t * 4 + 3] ) face = t;
+        errors += face < 0;
+        for( int k = 1; k < 4; k++ ) for( int c = 0; c < 4; c++ ) errors += tri.shade[k][c] != 0;
+        continue;
+      }
+
+      // Gouraud: Match The Top, Mid & Low Corners To Mesh Vertices, Each Color Plane Must Pass Through Their Vertex Colors
+      uint16_t top = nearest_mesh_vertex( &mesh, tri.xh, tri.yh );
+      uint16_t corner[3] = { top, nearest_mesh_vertex( &mesh, tri.xl, tri.ym ), nearest_mesh_vertex( &mesh, tri.xh + tri.dxhdy * (tri.yl - tri.yh), tri.yl ) };
+      errors += corner[0] == corner[1] || corner[1] == corner[2] || corner[0] == corner[2];
+      for( int k = 0; k < 3; k++ )
+        for( int c = 0; c < 4; c++ ) {
+          double value = tri.shade[0][c] + tri.shade[1][c] * (MeshXY[corner[k]].x - MeshXY[top].x) + tri.shade[3][c] * (MeshXY[corner[k]].y - MeshXY[top].y);
+          errors += fabs( value - CubeVertCol[corner[k] * 4 + c] ) > 0.5;
+        }
+    }
+    if( pass < 2 ) CHECK_EQ( triangles, visible ); // Unclipped: One Triangle Per Visible Face
+    else CHECK( triangles > visible ); // Clipped Faces Become Fans
+    CHECK_EQ( errors, 0 );
+  }
+}
+
+/*** MAIN ***/
+
+int main( void )
+{
+  test_writeback();
+  test_overflow();
+  test_sync();
+  test_triangle_fx();
+  test_fixed_3d();
+  test_frustum();
+  test_clip();
+  test_texture_triangle();
+  test_shade_triangle();
+  test_triangle_variants();
+  test_zbuffer_depth();
+  test_shade_mesh();
+
+  printf( "rdptest: %u checks, %u failed\n", test_checks, test_failures );
+  rdp_host_free();
+  return test_failures ? 1 : 0;
+}